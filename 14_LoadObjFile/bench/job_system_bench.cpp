@@ -0,0 +1,80 @@
+// LotJobSystem 스레드 수별 확장성 벤치마크 (1 ~ 32 스레드)
+// 사용법: job_system_bench [objectCount] [iterations]
+
+#include "../lot_job_system.h"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    using Mat4 = std::array<float, 16>;
+
+    Mat4 multiply(const Mat4 &a, const Mat4 &b) {
+        Mat4 r{};
+        for (int col = 0; col < 4; col++) {
+            for (int row = 0; row < 4; row++) {
+                float sum = 0.f;
+                for (int k = 0; k < 4; k++) {
+                    sum += a[k * 4 + row] * b[col * 4 + k];
+                }
+                r[col * 4 + row] = sum;
+            }
+        }
+        return r;
+    }
+
+    // 렌더 경로의 트랜스폼 갱신을 흉내 낸 작업 (T * R * S 후 projectionView 곱)
+    Mat4 buildTransform(size_t index) {
+        float angle = static_cast<float>(index) * 0.001f;
+        float c = std::cos(angle), s = std::sin(angle);
+        Mat4 translate{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+                       static_cast<float>(index % 100), 0.f, 2.5f, 1};
+        Mat4 rotate{c, 0, -s, 0, 0, 1, 0, 0, s, 0, c, 0, 0, 0, 0, 1};
+        Mat4 scale{.5f, 0, 0, 0, 0, .5f, 0, 0, 0, 0, .5f, 0, 0, 0, 0, 1};
+        return multiply(multiply(translate, rotate), scale);
+    }
+
+    double runBenchmark(lot::LotJobSystem &jobSystem, std::vector<Mat4> &output, int iterations) {
+        Mat4 projectionView = buildTransform(7);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < iterations; iter++) {
+            jobSystem.parallelFor(output.size(), 256, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    output[i] = multiply(projectionView, buildTransform(i + iter));
+                }
+            });
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+    }
+}
+
+int main(int argc, char **argv) {
+    size_t objectCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 50;
+
+    std::vector<Mat4> output(objectCount);
+
+    std::printf("objects: %zu, iterations: %d, hardware threads: %u\n",
+                objectCount, iterations, std::thread::hardware_concurrency());
+    std::printf("%8s %12s %10s\n", "threads", "ms/iter", "speedup");
+
+    double baseline = 0.0;
+    for (uint32_t threads : {1u, 2u, 4u, 8u, 16u, 32u}) {
+        // 호출 스레드도 작업에 참여하므로 워커 수는 threads - 1
+        lot::LotJobSystem jobSystem{threads - 1};
+        runBenchmark(jobSystem, output, 2);   // 워밍업
+
+        double ms = runBenchmark(jobSystem, output, iterations);
+        if (threads == 1) baseline = ms;
+        std::printf("%8u %12.3f %9.2fx\n", threads, ms, baseline / ms);
+    }
+
+    return EXIT_SUCCESS;
+}
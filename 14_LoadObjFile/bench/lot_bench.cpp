@@ -0,0 +1,239 @@
+// CPU 핫패스 마이크로벤치마크 (Google Benchmark, GPU/창 불필요)
+// 사용법: lot_bench [--benchmark_filter=<regex>] [--benchmark_format=json] ...
+// 엔진 최적화 전후로 같은 필터를 실행해 수치를 비교
+
+#include "../lot_camera.h"
+#include "../lot_game_object.h"
+#include "../lot_model.h"
+#include "../object_selection_manager.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef LOT_BENCH_MODEL_DIR
+    #define LOT_BENCH_MODEL_DIR "models"
+#endif
+
+namespace {
+    using lot::LotModel;
+    using lot::ObjectSelectionManager;
+
+    const char *const BUNDLED_MODELS[] = {"cube.obj", "colored_cube.obj", "smooth_vase.obj", "flat_vase.obj"};
+
+    std::string bundledModelPath(int64_t index) {
+        return std::string{LOT_BENCH_MODEL_DIR} + "/" + BUNDLED_MODELS[index];
+    }
+
+    // 경도/위도 segments개로 나눈 구를 OBJ로 저장 (정점/법선을 공유하므로 용접할 코너가 많음)
+    std::string writeSphereObj(int64_t segments) {
+        auto path = std::filesystem::temp_directory_path() / ("lot_bench_sphere_" + std::to_string(segments) + ".obj");
+        if (std::filesystem::exists(path)) {
+            return path.string();
+        }
+
+        std::ofstream file{path};
+        const float pi = 3.14159265358979f;
+        for (int64_t lat = 0; lat <= segments; lat++) {
+            float theta = pi * static_cast<float>(lat) / static_cast<float>(segments);
+            for (int64_t lon = 0; lon <= segments; lon++) {
+                float phi = 2.f * pi * static_cast<float>(lon) / static_cast<float>(segments);
+                float x = std::sin(theta) * std::cos(phi);
+                float y = std::cos(theta);
+                float z = std::sin(theta) * std::sin(phi);
+                file << "v " << x << " " << y << " " << z << "\n";
+                file << "vn " << x << " " << y << " " << z << "\n";
+            }
+        }
+        auto index = [segments](int64_t lat, int64_t lon) { return lat * (segments + 1) + lon + 1; };
+        for (int64_t lat = 0; lat < segments; lat++) {
+            for (int64_t lon = 0; lon < segments; lon++) {
+                int64_t a = index(lat, lon), b = index(lat + 1, lon);
+                int64_t c = index(lat + 1, lon + 1), d = index(lat, lon + 1);
+                file << "f " << a << "//" << a << " " << b << "//" << b << " " << c << "//" << c << "\n";
+                file << "f " << a << "//" << a << " " << c << "//" << c << " " << d << "//" << d << "\n";
+            }
+        }
+        return path.string();
+    }
+
+    std::vector<lot::Transformcomponent> makeTransforms(size_t count) {
+        std::mt19937 random{1};
+        std::uniform_real_distribution<float> unit{-1.f, 1.f};
+        std::vector<lot::Transformcomponent> transforms(count);
+        for (auto &transform : transforms) {
+            transform.translation = {unit(random) * 5.f, unit(random) * 5.f, unit(random) * 5.f};
+            transform.scale = glm::vec3{0.5f + 0.5f * std::abs(unit(random))};
+            transform.setRotationEuler(unit(random) * 3.f, unit(random) * 3.f, unit(random) * 3.f);
+        }
+        return transforms;
+    }
+
+    // 장면 중심을 향하는 레이 (일부는 빗나가도록 방향을 흩뜨림)
+    std::vector<ObjectSelectionManager::Ray> makeRays(size_t count) {
+        std::mt19937 random{2};
+        std::uniform_real_distribution<float> unit{-1.f, 1.f};
+        std::vector<ObjectSelectionManager::Ray> rays(count);
+        for (auto &ray : rays) {
+            ray.origin = {unit(random) * 0.2f, unit(random) * 0.2f, -3.f};
+            ray.direction = glm::normalize(glm::vec3{unit(random) * 0.4f, unit(random) * 0.4f, 1.f});
+        }
+        return rays;
+    }
+
+    // --- Transformcomponent::mat4 ---
+
+    void BM_TransformMat4(benchmark::State &state) {
+        auto transforms = makeTransforms(static_cast<size_t>(state.range(0)));
+        std::vector<glm::mat4> matrices(transforms.size());
+        for (auto _ : state) {
+            for (size_t i = 0; i < transforms.size(); i++) {
+                matrices[i] = transforms[i].mat4();
+            }
+            benchmark::DoNotOptimize(matrices.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_TransformMat4)->RangeMultiplier(8)->Range(64, 32768);
+
+    // --- LotCamera ---
+
+    void BM_CameraSetPerspectiveProjection(benchmark::State &state) {
+        lot::LotCamera camera{};
+        float aspect = 800.f / 600.f;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(aspect);
+            camera.setPerspectiveProjection(glm::radians(50.f), aspect, 0.1f, 10.f);
+            benchmark::DoNotOptimize(camera.getProjection());
+        }
+    }
+    BENCHMARK(BM_CameraSetPerspectiveProjection);
+
+    void BM_CameraSetViewDirection(benchmark::State &state) {
+        lot::LotCamera camera{};
+        glm::vec3 position{0.f, -1.f, -2.f};
+        glm::vec3 direction = glm::normalize(glm::vec3{0.2f, 0.3f, 1.f});
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(position);
+            camera.setViewDirection(position, direction);
+            benchmark::DoNotOptimize(camera.getView());
+        }
+    }
+    BENCHMARK(BM_CameraSetViewDirection);
+
+    // --- LotModel::Builder::loadModel (OBJ 파싱 + 버텍스 용접) ---
+
+    void BM_LoadModelBundled(benchmark::State &state) {
+        std::string path = bundledModelPath(state.range(0));
+        state.SetLabel(BUNDLED_MODELS[state.range(0)]);
+        size_t corners = 0;
+        for (auto _ : state) {
+            LotModel::Builder builder{};
+            builder.loadModel(path);
+            corners = builder.indices.size();
+            benchmark::DoNotOptimize(builder.vertices.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(corners));
+    }
+    BENCHMARK(BM_LoadModelBundled)->DenseRange(0, 3)->Unit(benchmark::kMillisecond);
+
+    void BM_LoadModelSphere(benchmark::State &state) {
+        std::string path = writeSphereObj(state.range(0));
+        size_t corners = 0;
+        for (auto _ : state) {
+            LotModel::Builder builder{};
+            builder.loadModel(path);
+            corners = builder.indices.size();
+            benchmark::DoNotOptimize(builder.vertices.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(corners));
+    }
+    BENCHMARK(BM_LoadModelSphere)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond);
+
+    // --- std::hash<Vertex> (hashCombine) ---
+
+    void BM_VertexHash(benchmark::State &state) {
+        LotModel::Builder builder{};
+        builder.loadModel(bundledModelPath(2));
+        const auto &vertices = builder.vertices;
+        for (auto _ : state) {
+            size_t combined = 0;
+            for (const auto &vertex : vertices) {
+                combined ^= std::hash<LotModel::Vertex>{}(vertex);
+            }
+            benchmark::DoNotOptimize(combined);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(vertices.size()));
+    }
+    BENCHMARK(BM_VertexHash);
+
+    // --- ObjectSelectionManager 교차 검사 ---
+
+    void BM_RayIntersectsBoundingBox(benchmark::State &state) {
+        auto rays = makeRays(1024);
+        ObjectSelectionManager::BoundingBox bbox{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}};
+        for (auto _ : state) {
+            size_t hits = 0;
+            for (const auto &ray : rays) {
+                hits += ObjectSelectionManager::rayIntersectsBoundingBox(ray, bbox) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(hits);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+    }
+    BENCHMARK(BM_RayIntersectsBoundingBox);
+
+    void BM_RayIntersectsBoundingBoxWithDistance(benchmark::State &state) {
+        auto rays = makeRays(1024);
+        ObjectSelectionManager::BoundingBox bbox{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}};
+        for (auto _ : state) {
+            float nearest = 0.f;
+            for (const auto &ray : rays) {
+                float distance = 0.f;
+                if (ObjectSelectionManager::rayIntersectsBoundingBoxWithDistance(ray, bbox, distance)) {
+                    nearest += distance;
+                }
+            }
+            benchmark::DoNotOptimize(nearest);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+    }
+    BENCHMARK(BM_RayIntersectsBoundingBoxWithDistance);
+
+    // 꽃병 메시의 삼각형 전체를 한 레이로 검사 (rayIntersectsMesh의 직렬 내부 루프와 같은 작업)
+    void BM_RayIntersectsTriangleMesh(benchmark::State &state) {
+        LotModel::Builder builder{};
+        builder.loadModel(bundledModelPath(2));
+        std::vector<ObjectSelectionManager::Triangle> triangles;
+        triangles.reserve(builder.indices.size() / 3);
+        for (size_t i = 0; i + 2 < builder.indices.size(); i += 3) {
+            triangles.push_back({builder.vertices[builder.indices[i]].position,
+                                 builder.vertices[builder.indices[i + 1]].position,
+                                 builder.vertices[builder.indices[i + 2]].position});
+        }
+        ObjectSelectionManager::Ray ray{{0.f, -0.2f, -1.f}, glm::normalize(glm::vec3{0.f, 0.05f, 1.f})};
+        for (auto _ : state) {
+            float closest = std::numeric_limits<float>::max();
+            for (const auto &triangle : triangles) {
+                float t = 0.f;
+                if (ObjectSelectionManager::rayIntersectsTriangle(ray, triangle, t) && t < closest) {
+                    closest = t;
+                }
+            }
+            benchmark::DoNotOptimize(closest);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(triangles.size()));
+    }
+    BENCHMARK(BM_RayIntersectsTriangleMesh);
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,46 @@
+# 컴파일된 SPIR-V 파일들을 constexpr uint32_t 배열로 변환해 하나의 .inc 파일로 생성
+# 사용법: cmake -DSPV_FILES="a.spv|b.spv" -DSPV_BASE_DIR=<dir> -DOUTPUT_FILE=<file> -P embed_spirv.cmake
+# 레지스트리 이름은 SPV_BASE_DIR 기준 상대 경로 (예: shaders/simple_shader.vert.spv)
+
+# SPV_FILES는 ';' 대신 '|'로 구분해 넘겨도 됨 (add_custom_command 인자 전달용)
+string(REPLACE "|" ";" SPV_FILES "${SPV_FILES}")
+
+if(NOT SPV_FILES OR NOT OUTPUT_FILE OR NOT SPV_BASE_DIR)
+    message(FATAL_ERROR "embed_spirv.cmake: SPV_FILES, SPV_BASE_DIR and OUTPUT_FILE are required")
+endif()
+
+set(CONTENT "// 자동 생성 파일 - 직접 수정하지 말 것 (cmake/embed_spirv.cmake)\n\n")
+set(TABLE "")
+
+foreach(SPV_FILE ${SPV_FILES})
+    file(RELATIVE_PATH SHADER_NAME "${SPV_BASE_DIR}" "${SPV_FILE}")
+    string(MAKE_C_IDENTIFIER "lot_spirv_${SHADER_NAME}" SYMBOL_NAME)
+
+    file(READ "${SPV_FILE}" HEX_DATA HEX)
+    string(LENGTH "${HEX_DATA}" HEX_LENGTH)
+    math(EXPR REMAINDER "${HEX_LENGTH} % 8")
+    if(HEX_LENGTH EQUAL 0 OR NOT REMAINDER EQUAL 0)
+        message(FATAL_ERROR "embed_spirv.cmake: ${SPV_FILE} is not a valid SPIR-V binary")
+    endif()
+
+    # 4바이트씩 리틀 엔디언 uint32로 묶음 (SPIR-V 워드)
+    string(REGEX REPLACE "(..)(..)(..)(..)" "0x\\4\\3\\2\\1u," WORDS "${HEX_DATA}")
+    # 한 줄에 8워드씩 (CMake 정규식은 {n} 반복을 지원하지 않음)
+    set(WORD "0x[0-9a-f]+u,")
+    string(REGEX REPLACE "(${WORD}${WORD}${WORD}${WORD}${WORD}${WORD}${WORD}${WORD})" "\\1\n        " WORDS "${WORDS}")
+    string(REGEX REPLACE "\n        $" "" WORDS "${WORDS}")
+
+    string(APPEND CONTENT "    alignas(4) constexpr uint32_t ${SYMBOL_NAME}[] = {\n        ${WORDS}\n    };\n\n")
+    string(APPEND TABLE "        {\"${SHADER_NAME}\", ${SYMBOL_NAME}, sizeof(${SYMBOL_NAME})},\n")
+endforeach()
+
+string(APPEND CONTENT "    constexpr LotEmbeddedShader EMBEDDED_SHADERS[] = {\n${TABLE}    };\n")
+
+# 내용이 같으면 다시 쓰지 않아 불필요한 재컴파일을 막음
+if(EXISTS "${OUTPUT_FILE}")
+    file(READ "${OUTPUT_FILE}" PREVIOUS_CONTENT)
+    if(PREVIOUS_CONTENT STREQUAL CONTENT)
+        return()
+    endif()
+endif()
+file(WRITE "${OUTPUT_FILE}" "${CONTENT}")
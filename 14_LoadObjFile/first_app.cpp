@@ -2,6 +2,11 @@
 
 #include "keyboard_move_ctrl.h"
 #include "lot_camera.h"
+#include "lot_cpu_profiler.h"
+#include "lot_job_system.h"
+#include "lot_flight_recorder.h"
+#include "lot_log.h"
+#include "lot_metrics.h"
 #include "simple_render_system.h"
 
 // libs
@@ -18,7 +23,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <iostream>
-
+#include <mutex>
 #include <thread>
 
 namespace lot {
@@ -28,14 +33,84 @@ namespace lot {
         alignas(16) glm::vec3 color;
     };
 
-    FirstApp::FirstApp() { loadGameObjects(); }
+    // 렌더 스레드가 스냅샷을 가져가길 기다리는 최대 시간 (입력 응답성 유지)
+    static constexpr auto MAX_SNAPSHOT_WAIT = std::chrono::milliseconds(50);
+    // 트랜스폼 계산을 잡 하나에 묶는 최소 객체 수
+    static constexpr size_t TRANSFORM_GRAIN_SIZE = 256;
+    // 객체 버퍼를 처음 만들 때의 최소 용량 (객체 수)
+    static constexpr size_t MIN_OBJECT_BUFFER_CAPACITY = 1024;
+    // 헤드리스 측정에서 제외하는 초기 프레임 수 (모든 프레임 슬롯의 버퍼/캐시가 채워질 때까지)
+    static constexpr uint32_t HEADLESS_WARMUP_FRAMES = 16;
+    // 벤치마크 회전 장면의 시뮬레이션 속도 (실제 프레임 시간과 무관하게 같은 프레임에서 같은 자세)
+    static constexpr float BENCHMARK_SIMULATION_RATE = 60.f;
+    // FPS 지표를 다시 계산하는 간격
+    static constexpr auto FPS_WINDOW = std::chrono::seconds(1);
+    // 온디맨드 모드: 유휴/최소화 상태에서 이벤트를 기다리는 최대 시간 (초, 디버그 출력 등 주기 작업 유지)
+    static constexpr double IDLE_WAIT_TIMEOUT = 0.25;
+    static constexpr double MINIMIZED_WAIT_TIMEOUT = 0.5;
+    // 온디맨드 모드: 포커스를 잃은 창의 최소 프레임 간격 (약 15 FPS)
+    static constexpr auto UNFOCUSED_FRAME_INTERVAL = std::chrono::milliseconds(66);
+    // 온디맨드 모드: 새 스냅샷이 없을 때 렌더 스레드가 창 크기 변경을 확인하는 간격
+    static constexpr auto RENDER_IDLE_WAIT = std::chrono::milliseconds(16);
+
+    // 렌더 스레드가 매 프레임 갱신하는 지표 (등록은 처음 한 번만)
+    struct RenderMetrics {
+        LotCounter& framesRendered;
+        LotGauge& fps;
+        LotHistogram& frameTimeMs;
+        LotGauge& drawCalls;
+        LotGauge& triangles;
+        LotGauge& objects;
+        // 프레임 구간 동안의 전역 operator new 호출 수 (정상 상태 목표는 0, 메인 스레드 할당도 포함)
+        LotGauge& heapAllocations;
+    };
+
+    static RenderMetrics& renderMetrics() {
+        auto& metrics = LotMetrics::instance();
+        static RenderMetrics renderMetrics{
+            metrics.counter("frames_rendered"),
+            metrics.gauge("fps"),
+            metrics.histogram("frame_time_ms", {4.0, 8.0, 16.7, 33.3, 50.0, 100.0, 250.0}),
+            metrics.gauge("draw_calls"),
+            metrics.gauge("triangles"),
+            metrics.gauge("objects"),
+            metrics.gauge("frame_heap_allocations") };
+        return renderMetrics;
+    }
+
+    FirstApp::FirstApp(const FirstAppOptions& options)
+    : options{options},
+      lotWindow{options.headless ? nullptr : std::make_unique<LotWindow>(WIDTH, HEIGHT, "Hellow Lot Vulkan!!!")},
+      lotDevice{lotWindow.get()},
+      lotRenderer{lotWindow.get(), lotDevice, options.headlessExtent, options.swapChainConfig},
+      framePacer{options.framePacerConfig} {
+        metricsServer = LotMetricsServer::createFromEnvironment();
+        if (options.benchmark) {
+            loadBenchmarkScene();
+        } else {
+            loadGameObjects();
+        }
+    }
 
     FirstApp::~FirstApp() {
+        if (renderThread.joinable()) {
+            renderThreadRunning = false;
+            renderThread.join();
+        }
+        std::lock_guard<std::mutex> lock{lotDevice.queueMutex()};
         vkDeviceWaitIdle(lotDevice.device());
     }
 
     void FirstApp::run() {
-        SimpleRenderSystem simpleRenderSystem{ lotDevice, lotRenderer.getSwapChainRenderPass() };
+        if (options.benchmark) {
+            runBenchmark();
+            return;
+        }
+        if (!lotWindow) {
+            runHeadless();
+            return;
+        }
+
         LotCamera camera{};
 
         auto viewerObject = LotGameObject::createGameObject();
@@ -43,93 +118,616 @@ namespace lot {
         KeyboardMoveCtrl cameraCtrl{};
         glm::vec3 orbitTarget{0.0f, 0.0f, 2.5f};
 
-        // 마우스 휠 콜백 설정
         auto projectionType = KeyboardMoveCtrl::ProjectionType::Perspective;
-        KeyboardMoveCtrl::setInstance(&cameraCtrl);
-        glfwSetScrollCallback(lotWindow.getGLFWwindow(), KeyboardMoveCtrl::scrollCallback);
-        glfwSetCursorPosCallback(lotWindow.getGLFWwindow(), KeyboardMoveCtrl::mouseCallback);
 
+        // 입력 계층 (기록/재생 모드 포함, 마우스 휠 콜백 등록)
+        auto inputMode = LotInput::Mode::Live;
+        std::string inputPath;
+        if (!options.replayInputPath.empty()) {
+            inputMode = LotInput::Mode::Replay;
+            inputPath = options.replayInputPath;
+        } else if (!options.recordInputPath.empty()) {
+            inputMode = LotInput::Mode::Record;
+            inputPath = options.recordInputPath;
+        }
+        LotInput input{lotWindow->getGLFWwindow(), inputMode, inputPath, options.replayTimestep};
+        // 재생은 기록된 프레임 간격대로 진행해야 하므로 온디맨드 대기를 쓰지 않음
+        bool renderOnDemand = options.renderOnDemand && inputMode != LotInput::Mode::Replay;
+
+        // 기록/제출/프레젠트는 렌더 스레드가 담당하고, 메인 스레드는 이벤트/입력/시뮬레이션만 처리
+        LOT_PROFILE_THREAD("Main");
+        startRenderThread();
+
+        // 메인 스레드 히치 (업로드의 큐 대기 등)는 렌더 스레드와 따로 기록
+        LotFlightRecorder flightRecorder{"main", LotFlightRecorder::configFromEnvironment()};
         auto currentTime = std::chrono::high_resolution_clock::now();
-        while (!lotWindow.shouldClose()) {
-            glfwPollEvents();
+        // 마지막으로 렌더 스레드에 보낸 상태 (온디맨드 모드의 변경 감지용)
+        uint64_t publishedSceneVersion = 0;
+        glm::mat4 publishedView{0.f};
+        glm::mat4 publishedProjection{0.f};
+        bool idle = false;
+        auto lastFrameStart = std::chrono::steady_clock::now();
+        while (!lotWindow->shouldClose() && !input.isReplayFinished() &&
+               renderThreadRunning.load(std::memory_order_acquire)) {
+            if (renderOnDemand) {
+                LOT_PROFILE_SCOPE("throttleMainLoop");
+                throttleMainLoop(idle, lastFrameStart);
+                if (idle) {
+                    // 기다린 시간만큼 카메라가 한 번에 움직이지 않도록 프레임 시간 기준을 다시 잡음
+                    currentTime = std::chrono::high_resolution_clock::now();
+                }
+            }
+            // 프레젠트되지 않은 프레임이 너무 많으면 입력을 읽기 전에 기다림 (입력 지연 제한)
+            framePacer.waitForFrameSlot(frameCounter, renderThreadRunning);
+            lastFrameStart = std::chrono::steady_clock::now();
+
+            LOT_PROFILE_SCOPE("MainFrame");
+            flightRecorder.beginFrame();
+            flightRecorder.beginPhase("pollEvents");
+            {
+                LOT_PROFILE_SCOPE("glfwPollEvents");
+                glfwPollEvents();
+            }
+            auto inputTime = std::chrono::steady_clock::now();
 
             auto newTime = std::chrono::high_resolution_clock::now();
-            float frameTime = std::chrono::duration<float, std::chrono::seconds::period>(newTime - currentTime).count();
+            float wallFrameTime = std::chrono::duration<float, std::chrono::seconds::period>(newTime - currentTime).count();
             currentTime = newTime;
+            // 재생 중에는 실제 경과 시간 대신 고정 간격으로 시뮬레이션
+            float frameTime = input.beginFrame(wallFrameTime);
 
-            float aspect = lotRenderer.getAspectRatio();
+            float aspect = getWindowAspectRatio();
 
             // 입력 처리 및 업데이트
-            updateCamera(cameraCtrl, frameTime, viewerObject, orbitTarget, projectionType);
-            updateProjection(camera, projectionType, aspect, viewerObject, orbitTarget);
-            handleInputs(newTime, viewerObject, camera);
+            flightRecorder.beginPhase("update");
+            {
+                LOT_PROFILE_SCOPE("update");
+                updateCamera(input, cameraCtrl, frameTime, viewerObject, orbitTarget, projectionType);
+                updateProjection(camera, projectionType, aspect, viewerObject, orbitTarget);
+                // 렌더 스레드가 아직 이전 스냅샷을 기록 중이어도 제출 시점에는 이 카메라를 사용
+                if (options.lateLatchCamera) {
+                    publishLatchedCamera(camera, projectionType, inputTime);
+                }
+                uint64_t selectionVersion = selectionManager.getSelectionVersion();
+                handleInputs(input, newTime, viewerObject, camera);
+                if (selectionManager.getSelectionVersion() != selectionVersion) {
+                    markSceneChanged();
+                }
+            }
 
-            // 렌더링
-            if (lotWindow.isUserResizing()) {
-                handleResizing();
+            // 온디맨드 모드에서는 화면에 보일 변화가 있을 때만 새 프레임을 만듦
+            bool redraw = true;
+            if (renderOnDemand) {
+                redraw = !lotWindow->isMinimized() &&
+                         (sceneVersion != publishedSceneVersion ||
+                          camera.getView() != publishedView ||
+                          camera.getProjection() != publishedProjection ||
+                          input.isAnyInputDown() || input.wasWindowResized());
+                idle = !redraw;
+            }
+            if (!redraw) {
+                flightRecorder.endFrame();
                 continue;
             }
+            publishedSceneVersion = sceneVersion;
+            publishedView = camera.getView();
+            publishedProjection = camera.getProjection();
 
-            render(simpleRenderSystem, camera);
+            // 렌더 스레드로 스냅샷 전달 (이전 프레임 기록과 다음 프레임 시뮬레이션이 겹쳐 실행됨)
+            flightRecorder.beginPhase("publishFrameSnapshot");
+            {
+                LOT_PROFILE_SCOPE("publishFrameSnapshot");
+                publishFrameSnapshot(camera, projectionType, frameTime, inputTime);
+            }
+            flightRecorder.beginPhase("waitForSnapshotConsumed");
+            {
+                LOT_PROFILE_SCOPE("waitForSnapshotConsumed");
+                waitForSnapshotConsumed();
+            }
+            flightRecorder.endFrame();
         }
-        vkDeviceWaitIdle(lotDevice.device());
+        stopRenderThread();
+        LotCpuProfiler::instance().writeTraceIfRequested();
+        if (double latency = framePacer.getAverageLatencyMs(); latency > 0.0) {
+            LOT_LOG_INFO("Average input-to-present latency: {} ms", latency);
+        }
+    }
+
+    void FirstApp::startRenderThread() {
+        renderThreadError = nullptr;
+        renderThreadRunning = true;
+        renderThread = std::thread(&FirstApp::renderLoop, this);
+    }
+
+    void FirstApp::stopRenderThread() {
+        renderThreadRunning = false;
+        {
+            std::lock_guard<std::mutex> lock{snapshotMutex};
+        }
+        snapshotPublished.notify_one();
+        if (renderThread.joinable()) {
+            renderThread.join();
+        }
+        if (renderThreadError) {
+            std::rethrow_exception(renderThreadError);
+        }
+    }
+
+    void FirstApp::publishFrameSnapshot(const LotCamera& camera,
+                                        KeyboardMoveCtrl::ProjectionType projectionType, float frameTime,
+                                        std::chrono::steady_clock::time_point inputTime) {
+        fillFrameSnapshot(frameSnapshots.writeBuffer(), camera, projectionType, frameTime);
+        frameSnapshots.writeBuffer().inputTime = inputTime;
+        {
+            // 렌더 스레드가 조건 확인과 대기 사이에 알림을 놓치지 않도록 잠금 안에서 교환
+            std::lock_guard<std::mutex> lock{snapshotMutex};
+            frameSnapshots.publish();
+        }
+        snapshotPublished.notify_one();
+    }
+
+    void FirstApp::publishLatchedCamera(const LotCamera& camera, KeyboardMoveCtrl::ProjectionType projectionType,
+                                        std::chrono::steady_clock::time_point inputTime) {
+        auto& latched = cameraLatch.writeBuffer();
+        latched.inputTime = inputTime;
+        latched.camera = camera;
+        latched.projectionType = projectionType;
+        cameraLatch.publish();
+    }
+
+    void FirstApp::fillFrameSnapshot(FrameSnapshot& snapshot, const LotCamera& camera,
+                                     KeyboardMoveCtrl::ProjectionType projectionType, float frameTime) {
+        snapshot.frameNumber = ++frameCounter;
+        snapshot.sceneVersion = sceneVersion;
+        snapshot.frameTime = frameTime;
+        snapshot.inputTime = {};
+        snapshot.camera = camera;
+        snapshot.projectionType = projectionType;
+
+        // 슬롯을 재사용하므로 용량은 유지되고 모델 참조만 갱신됨
+        snapshot.objects.resize(gameObjects.size());
+        LotJobSystem::instance().parallelFor(gameObjects.size(), TRANSFORM_GRAIN_SIZE, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const auto& obj = gameObjects[i];
+                auto& renderObject = snapshot.objects[i];
+                renderObject.id = obj.getId();
+                renderObject.model = obj.model;
+                renderObject.modelMatrix = obj.transform.mat4();
+                renderObject.color = obj.color;
+                renderObject.isSelected = obj.isSelected;
+            }
+        });
+    }
+
+    void FirstApp::throttleMainLoop(bool idle, std::chrono::steady_clock::time_point lastFrameStart) {
+        if (lotWindow->isMinimized()) {
+            glfwWaitEventsTimeout(MINIMIZED_WAIT_TIMEOUT);
+            return;
+        }
+        if (!lotWindow->isFocused()) {
+            std::this_thread::sleep_until(lastFrameStart + UNFOCUSED_FRAME_INTERVAL);
+        }
+        if (idle) {
+            glfwWaitEventsTimeout(IDLE_WAIT_TIMEOUT);
+        }
+    }
+
+    void FirstApp::waitForSnapshotConsumed() {
+        // 렌더 스레드보다 한 프레임 이상 앞서 나가지 않도록 제한 (렌더 스레드가 가져가면 바로 깨어남)
+        std::unique_lock<std::mutex> lock{snapshotMutex};
+        snapshotConsumed.wait_for(lock, MAX_SNAPSHOT_WAIT, [this] {
+            return !frameSnapshots.hasPending() || !renderThreadRunning.load(std::memory_order_acquire);
+        });
+    }
+
+    void FirstApp::notifySnapshotConsumed(bool acquired) {
+        if (!acquired) {
+            return;
+        }
+        {
+            // 메인 스레드가 조건 확인과 대기 사이에 알림을 놓치지 않도록 잠금을 한 번 거침
+            std::lock_guard<std::mutex> lock{snapshotMutex};
+        }
+        snapshotConsumed.notify_one();
+    }
+
+    void FirstApp::createRenderThreadResources(RenderThreadResources& resources) {
+        resources.globalPool = LotDescriptorPool::Builder(lotDevice)
+            .setMaxSets(LotSwapChain::MAX_FRAMES_IN_FLIGHT)
+            .addPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, LotSwapChain::MAX_FRAMES_IN_FLIGHT)
+            .addPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, LotSwapChain::MAX_FRAMES_IN_FLIGHT)
+            .build();
+
+        resources.globalSetLayout = LotDescriptorSetLayout::Builder(lotDevice)
+            .addBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_ALL_GRAPHICS)
+            .addBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
+            .build();
+
+        // 프레임 슬롯 수만큼의 인스턴스를 하나의 버퍼에 두고 한 번만 매핑
+        // HOST_COHERENT이므로 매 프레임 쓰기 후 flush가 필요 없음
+        resources.uboRing = std::make_unique<LotBuffer>(
+            lotDevice,
+            sizeof(GlobalUbo),
+            LotSwapChain::MAX_FRAMES_IN_FLIGHT,
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            lotDevice.properties.limits.minUniformBufferOffsetAlignment);
+        resources.uboRing->map();
+
+        resources.startTime = std::chrono::steady_clock::now();
+        resources.gpuProfiler = std::make_unique<LotGpuProfiler>(lotDevice, LotSwapChain::MAX_FRAMES_IN_FLIGHT);
+        resources.flightRecorder = std::make_unique<LotFlightRecorder>(
+            "render", LotFlightRecorder::configFromEnvironment());
+
+        // 실제로 쓰는 프레임 슬롯만 준비 (배열 크기는 MAX_FRAMES_IN_FLIGHT)
+        for (int i = 0; i < static_cast<int>(lotRenderer.getFramesInFlight()); i++) {
+            ensureObjectBufferCapacity(resources, i, MIN_OBJECT_BUFFER_CAPACITY);
+            resources.frameArenas[i] = std::make_unique<LotFrameArena>();
+        }
+    }
+
+    void FirstApp::ensureObjectBufferCapacity(RenderThreadResources& resources, int frameIndex, size_t objectCount) {
+        auto& objectBuffer = resources.objectBuffers[frameIndex];
+        size_t capacity = objectBuffer ? objectBuffer->getInstanceCount() : 0;
+        if (objectCount <= capacity && objectBuffer) {
+            return;
+        }
+
+        // 이 프레임 슬롯의 펜스는 이미 대기했으므로 이전 버퍼를 바로 해제해도 안전
+        size_t newCapacity = std::max({objectCount, capacity * 2, MIN_OBJECT_BUFFER_CAPACITY});
+        objectBuffer = std::make_unique<LotBuffer>(
+            lotDevice,
+            sizeof(ObjectData),
+            static_cast<uint32_t>(newCapacity),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        objectBuffer->map();
+
+        writeGlobalDescriptorSet(resources, frameIndex);
+    }
+
+    void FirstApp::writeGlobalDescriptorSet(RenderThreadResources& resources, int frameIndex) {
+        auto uboInfo = resources.uboRing->descriptorInfoForIndex(frameIndex);
+        auto objectInfo = resources.objectBuffers[frameIndex]->descriptorInfo();
+
+        LotDescriptorWriter writer{*resources.globalSetLayout, *resources.globalPool};
+        writer.writeBuffer(0, &uboInfo).writeBuffer(1, &objectInfo);
+
+        if (resources.globalDescriptorSets[frameIndex] == VK_NULL_HANDLE) {
+            if (!writer.build(resources.globalDescriptorSets[frameIndex])) {
+                throw std::runtime_error("failed to allocate global descriptor set!");
+            }
+        } else {
+            writer.overwrite(resources.globalDescriptorSets[frameIndex]);
+        }
+
+        // 셋을 갱신하면 이 셋을 바인딩해 기록한 커맨드 버퍼는 무효가 되므로 캐시도 다시 기록하게 함
+        resources.descriptorVersions[frameIndex]++;
+    }
+
+    void FirstApp::dumpGpuProfile(RenderThreadResources& resources) {
+        resources.gpuProfiler->collectPendingResults();
+        const char *path = std::getenv("LOT_GPU_PROFILE");
+        if (path == nullptr || !resources.gpuProfiler->isEnabled()) {
+            return;
+        }
+        resources.gpuProfiler->dump(path);
+        std::cout << "[GpuProfiler] Wrote " << resources.gpuProfiler->getHistory().size()
+                  << " frames to " << path << std::endl;
+    }
+
+    void FirstApp::renderLoop() {
+        LOT_PROFILE_THREAD("Render");
+        try {
+            // 렌더 시스템보다 먼저 선언하여 디바이스 대기 이후에 자원/모델 참조가 해제되도록 함
+            RenderThreadResources resources{};
+            createRenderThreadResources(resources);
+            LotPipelineManager pipelineManager{lotDevice};
+            SimpleRenderSystem simpleRenderSystem{
+                lotDevice, pipelineManager,
+                lotRenderer.getSwapChainRenderPass(), resources.globalSetLayout->getDescriptorSetLayout() };
+
+            bool hasSnapshot = false;
+            while (renderThreadRunning.load(std::memory_order_acquire)) {
+                bool acquired = false;
+                if (options.renderOnDemand) {
+                    // 유휴 동안에는 beginFrame이 불리지 않으므로 여기서 지연 파괴를 처리하고,
+                    // GPU가 모든 프레임을 끝냈으면 슬롯별로 붙잡아 둔 모델도 놓아 다음 확인 때 해제되게 함
+                    if (lotRenderer.collectIdleDeletions()) {
+                        for (size_t i = 0; i < resources.inFlightModels.size(); i++) {
+                            resources.inFlightModels[i].clear();
+                            resources.retainedSceneVersions[i] = 0;
+                        }
+                    }
+
+                    // 새 스냅샷이나 창 크기 변경(드래그 중 메인 스레드가 멈춰 있을 수 있음)이 있을 때만 렌더링
+                    std::unique_lock<std::mutex> lock{snapshotMutex};
+                    snapshotPublished.wait_for(lock, RENDER_IDLE_WAIT, [this] {
+                        return frameSnapshots.hasPending() || !renderThreadRunning.load(std::memory_order_acquire);
+                    });
+                    lock.unlock();
+                    VkExtent2D extent = lotWindow->getExtent();
+                    bool resized = lotWindow->wasWindowReSized() && extent.width > 0 && extent.height > 0;
+                    acquired = frameSnapshots.acquire();
+                    hasSnapshot = acquired || hasSnapshot;
+                    if (!hasSnapshot || (!acquired && !resized)) {
+                        continue;
+                    }
+                } else {
+                    // 새 스냅샷을 기다리고, 한동안 오지 않으면(창 드래그 중 메인 스레드가 멈춤)
+                    // 마지막 스냅샷으로 다시 렌더링해 화면 갱신을 유지
+                    {
+                        std::unique_lock<std::mutex> lock{snapshotMutex};
+                        snapshotPublished.wait_for(lock, RENDER_IDLE_WAIT, [this] {
+                            return frameSnapshots.hasPending() || !renderThreadRunning.load(std::memory_order_acquire);
+                        });
+                    }
+                    acquired = frameSnapshots.acquire();
+                    hasSnapshot = acquired || hasSnapshot;
+                    if (!hasSnapshot) {
+                        continue;
+                    }
+                }
+                // 기록을 시작하기 전에 알려 메인 스레드가 다음 프레임 시뮬레이션과 겹쳐 실행되게 함
+                notifySnapshotConsumed(acquired);
+
+                render(simpleRenderSystem, frameSnapshots.readBuffer(), resources);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{lotDevice.queueMutex()};
+                vkDeviceWaitIdle(lotDevice.device());
+            }
+            dumpGpuProfile(resources);
+        } catch (...) {
+            renderThreadError = std::current_exception();
+            renderThreadRunning = false;
+            notifySnapshotConsumed(true);
+        }
+    }
+
+    void FirstApp::runHeadless() {
+        LOT_PROFILE_THREAD("Main");
+        LotCamera camera{};
+        auto viewerObject = LotGameObject::createGameObject();
+        auto projectionType = KeyboardMoveCtrl::ProjectionType::Perspective;
+        camera.setViewFromTransform(viewerObject.transform.translation, viewerObject.transform.rotation);
+        applyProjection(camera, projectionType, lotRenderer.getAspectRatio());
+
+        std::vector<double> frameTimesMs;
+        frameTimesMs.reserve(options.headlessFrames);
+        std::chrono::steady_clock::time_point measureStart{};
+        double totalSeconds = 0.0;
+        {
+            RenderThreadResources resources{};
+            createRenderThreadResources(resources);
+            LotPipelineManager pipelineManager{lotDevice};
+            SimpleRenderSystem simpleRenderSystem{
+                lotDevice, pipelineManager,
+                lotRenderer.getSwapChainRenderPass(), resources.globalSetLayout->getDescriptorSetLayout() };
+            // 백그라운드 파이프라인 컴파일이 측정 구간에 섞이지 않도록 먼저 끝냄
+            pipelineManager.waitIdle();
+
+            FrameSnapshot snapshot{};
+            float frameTime = 0.f;
+            uint32_t totalFrames = HEADLESS_WARMUP_FRAMES + options.headlessFrames;
+            measureStart = std::chrono::steady_clock::now();
+            for (uint32_t frame = 0; frame < totalFrames; frame++) {
+                auto frameStart = std::chrono::steady_clock::now();
+                fillFrameSnapshot(snapshot, camera, projectionType, frameTime);
+                render(simpleRenderSystem, snapshot, resources);
+                auto frameEnd = std::chrono::steady_clock::now();
+
+                frameTime = std::chrono::duration<float>(frameEnd - frameStart).count();
+                if (frame < HEADLESS_WARMUP_FRAMES) {
+                    measureStart = frameEnd;
+                } else {
+                    frameTimesMs.push_back(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{lotDevice.queueMutex()};
+                vkDeviceWaitIdle(lotDevice.device());
+            }
+            // 마지막으로 제출한 프레임의 GPU 완료까지 포함한 처리량
+            totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - measureStart).count();
+
+            dumpGpuProfile(resources);
+            const auto& gpuProfiler = *resources.gpuProfiler;
+            if (gpuProfiler.isEnabled()) {
+                std::cout << "[GpuProfiler] avg ms over last " << gpuProfiler.getHistory().size() << " frames"
+                          << " - renderPass: " << gpuProfiler.getAverageMilliseconds("renderPass")
+                          << ", renderGameObjects: " << gpuProfiler.getAverageMilliseconds("renderGameObjects")
+                          << ", renderHighlights: " << gpuProfiler.getAverageMilliseconds("renderHighlights")
+                          << std::endl;
+            }
+        }
+        LotCpuProfiler::instance().writeTraceIfRequested();
+
+        if (frameTimesMs.empty()) {
+            return;
+        }
+        LotFrameTimeStats stats = LotFrameTimeStats::compute(frameTimesMs);
+
+        VkExtent2D extent = lotRenderer.getSwapChainExtent();
+        std::cout << "=== Headless Frame Timing ===" << std::endl;
+        std::cout << "device: " << lotDevice.properties.deviceName
+                  << ", extent: " << extent.width << "x" << extent.height
+                  << ", objects: " << gameObjects.size() << std::endl;
+        std::cout << "frames: " << frameTimesMs.size() << " (+" << HEADLESS_WARMUP_FRAMES << " warmup)"
+                  << ", total: " << totalSeconds << " s"
+                  << ", fps: " << static_cast<double>(frameTimesMs.size()) / totalSeconds << std::endl;
+        std::cout << "frame ms - avg: " << stats.average
+                  << ", min: " << stats.min
+                  << ", p50: " << stats.p50
+                  << ", p95: " << stats.p95
+                  << ", p99: " << stats.p99
+                  << ", max: " << stats.max << std::endl;
     }
 
-    void FirstApp::updateCamera(KeyboardMoveCtrl& cameraCtrl, float frameTime,
+    void FirstApp::runBenchmark() {
+        LOT_PROFILE_THREAD("Main");
+        const LotBenchmarkConfig& config = options.benchmarkConfig;
+        LotCamera camera{};
+        auto projectionType = KeyboardMoveCtrl::ProjectionType::Perspective;
+
+        LotBenchmarkReport report{};
+        report.deviceName = lotDevice.properties.deviceName;
+        report.presentMode = LotSwapChain::presentModeName(options.swapChainConfig.presentMode);
+        report.framesInFlight = lotRenderer.getFramesInFlight();
+        report.headless = !lotWindow;
+        report.warmupFrames = HEADLESS_WARMUP_FRAMES;
+        report.frameTimesMs.reserve(options.headlessFrames);
+        for (const auto& obj : gameObjects) {
+            report.selectedObjects += obj.isSelected ? 1 : 0;
+            report.triangles += obj.model->getTriangleCount();
+        }
+
+        // 측정 구간 합계 (끝나고 프레임 수로 나눔)
+        double updateMs = 0.0;
+        std::array<double, LotFlightRecorder::MAX_PHASES> renderPhaseMs{};
+        uint64_t allocations = 0;
+        {
+            RenderThreadResources resources{};
+            createRenderThreadResources(resources);
+            LotPipelineManager pipelineManager{lotDevice};
+            SimpleRenderSystem simpleRenderSystem{
+                lotDevice, pipelineManager,
+                lotRenderer.getSwapChainRenderPass(), resources.globalSetLayout->getDescriptorSetLayout() };
+            pipelineManager.waitIdle();
+
+            FrameSnapshot snapshot{};
+            float frameTime = 0.f;
+            uint32_t totalFrames = HEADLESS_WARMUP_FRAMES + options.headlessFrames;
+            auto measureStart = std::chrono::steady_clock::now();
+            for (uint32_t frame = 0; frame < totalFrames; frame++) {
+                if (lotWindow) {
+                    glfwPollEvents();
+                    if (lotWindow->shouldClose()) {
+                        break;
+                    }
+                }
+
+                auto frameStart = std::chrono::steady_clock::now();
+                uint64_t allocationsAtStart = LotFlightRecorder::allocationCount();
+
+                // 카메라는 측정 구간 동안 장면을 한 바퀴 돎 (워밍업 동안은 시작 자세)
+                bool warmup = frame < HEADLESS_WARMUP_FRAMES;
+                float t = warmup ? 0.f : static_cast<float>(frame - HEADLESS_WARMUP_FRAMES) /
+                                         static_cast<float>(options.headlessFrames);
+                glm::vec3 position{};
+                glm::vec3 target{};
+                LotBenchmark::cameraPose(t, position, target);
+                camera.setViewTarget(position, target);
+                applyProjection(camera, projectionType, lotRenderer.getAspectRatio());
+                if (config.rotating) {
+                    LotBenchmark::animateScene(config, static_cast<float>(frame) / BENCHMARK_SIMULATION_RATE,
+                                               gameObjects);
+                }
+                fillFrameSnapshot(snapshot, camera, projectionType, frameTime);
+                auto updateEnd = std::chrono::steady_clock::now();
+
+                render(simpleRenderSystem, snapshot, resources);
+                auto frameEnd = std::chrono::steady_clock::now();
+
+                frameTime = std::chrono::duration<float>(frameEnd - frameStart).count();
+                if (warmup) {
+                    measureStart = frameEnd;
+                    continue;
+                }
+                report.frameTimesMs.push_back(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+                allocations += LotFlightRecorder::allocationCount() - allocationsAtStart;
+                updateMs += std::chrono::duration<double, std::milli>(updateEnd - frameStart).count();
+                const auto& lastFrame = resources.flightRecorder->getLastFrame();
+                for (uint32_t i = 0; i < renderPhaseMs.size(); i++) {
+                    renderPhaseMs[i] += lastFrame.phaseMs[i];
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{lotDevice.queueMutex()};
+                vkDeviceWaitIdle(lotDevice.device());
+            }
+            report.totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - measureStart).count();
+
+            dumpGpuProfile(resources);
+            const auto& gpuProfiler = *resources.gpuProfiler;
+            if (gpuProfiler.isEnabled()) {
+                for (const char* scope : {"renderPass", "renderGameObjects", "renderHighlights"}) {
+                    report.gpuMs[scope] = gpuProfiler.getAverageMilliseconds(scope);
+                }
+            }
+
+            size_t measuredFrames = report.frameTimesMs.size();
+            if (measuredFrames > 0) {
+                double frames = static_cast<double>(measuredFrames);
+                report.cpuMs["update"] = updateMs / frames;
+                const auto& flightRecorder = *resources.flightRecorder;
+                for (uint32_t i = 0; i < flightRecorder.getPhaseCount(); i++) {
+                    report.cpuMs[std::string{"render."} + flightRecorder.getPhaseName(i)] = renderPhaseMs[i] / frames;
+                }
+                report.allocationsPerFrame = static_cast<double>(allocations) / frames;
+            }
+            // 렌더 자원을 해제하기 전의 GPU 메모리 사용량
+            report.gpuMemoryBytes = LotMetrics::instance().gauge("gpu_memory_bytes").get();
+        }
+        LotCpuProfiler::instance().writeTraceIfRequested();
+
+        VkExtent2D extent = lotRenderer.getSwapChainExtent();
+        report.width = extent.width;
+        report.height = extent.height;
+        report.peakResidentBytes = LotBenchmark::peakResidentBytes();
+        LotBenchmark::writeReport(config, report);
+    }
+
+    void FirstApp::updateCamera(LotInput& input, KeyboardMoveCtrl& cameraCtrl, float frameTime,
                                LotGameObject& viewerObject, glm::vec3& orbitTarget,
                                KeyboardMoveCtrl::ProjectionType projectionType) {
         // 카메라 이동 제어
-        cameraCtrl.moveInPlaneXZ(lotWindow.getGLFWwindow(), frameTime, viewerObject);
+        cameraCtrl.moveInPlaneXZ(input, frameTime, viewerObject);
 
-        // 객체 회전 처리
-        cameraCtrl.rotateObjects(lotWindow.getGLFWwindow(), frameTime, gameObjects);
+        // 객체 회전 처리 (편집으로 바뀐 트랜스폼은 장면 변경으로 알림)
+        if (cameraCtrl.rotateObjects(input, frameTime, gameObjects)) {
+            markSceneChanged();
+        }
 
         // 투영 관련 설정
         float orthoSize = 1.0f;
         float fov = glm::radians(50.0f);
-        float aspect = lotRenderer.getAspectRatio();
+        float aspect = getWindowAspectRatio();
 
         // 마우스 줄 처리
-        cameraCtrl.processScrollInput(lotWindow.getGLFWwindow(), projectionType,
+        cameraCtrl.processScrollInput(input, projectionType,
                                      orthoSize, viewerObject, orbitTarget, fov);
 
         // 마우스 카메라 제어
         cameraCtrl.handleMouseCameraControlWithProjection(
-            lotWindow.getGLFWwindow(), frameTime, viewerObject, orbitTarget,
+            input, frameTime, viewerObject, orbitTarget,
             orthoSize, aspect
         );
     }
 
-    void FirstApp::handleInputs(const std::chrono::high_resolution_clock::time_point& currentTime, const LotGameObject& viewerObject, LotCamera& camera) {
+    void FirstApp::handleInputs(LotInput& input, const std::chrono::high_resolution_clock::time_point& currentTime, const LotGameObject& viewerObject, LotCamera& camera) {
         // 객체 선택 처리 (메인 카메라 사용)
-        selectionManager.handleMouseClick(lotWindow.getGLFWwindow(), camera, gameObjects);
-
-        // 키보드 입력 처리
-        static bool keyPressed = false;
+        selectionManager.handleMouseClick(input, camera, gameObjects);
 
+        // 키보드 입력 처리 (추가/삭제는 누른 프레임에 한 번만)
         // ESC: 모든 선택 해제
-        if (glfwGetKey(lotWindow.getGLFWwindow(), GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+        if (input.isActionDown(LotInputAction::ClearSelection)) {
             selectionManager.clearAllSelections(gameObjects);
         }
 
         // N: 새 큐브 추가
-        if (glfwGetKey(lotWindow.getGLFWwindow(), GLFW_KEY_N) == GLFW_PRESS && !keyPressed) {
-            keyPressed = true;
+        if (input.isActionPressed(LotInputAction::AddCube)) {
             addNewCube();
-            std::cout << "New cube added! Total objects: " << gameObjects.size() << std::endl;
+            LOT_LOG_INFO("New cube added! Total objects: {}", gameObjects.size());
         }
 
         // Delete: 선택된 객체 삭제
-        if (glfwGetKey(lotWindow.getGLFWwindow(), GLFW_KEY_DELETE) == GLFW_PRESS && !keyPressed) {
-            keyPressed = true;
+        if (input.isActionPressed(LotInputAction::DeleteSelected)) {
             removeSelectedObjects();
-            std::cout << "Selected objects removed! Total objects: " << gameObjects.size() << std::endl;
-        }
-
-        // 키 릴리스 체크
-        if (glfwGetKey(lotWindow.getGLFWwindow(), GLFW_KEY_N) == GLFW_RELEASE &&
-            glfwGetKey(lotWindow.getGLFWwindow(), GLFW_KEY_DELETE) == GLFW_RELEASE) {
-            keyPressed = false;
+            LOT_LOG_INFO("Selected objects removed! Total objects: {}", gameObjects.size());
         }
 
         // 디버그 출력 (5초마다)
@@ -141,6 +739,10 @@ namespace lot {
         // 3DS Max 스타일 자유 회전 - 무제한 상하좌우 회전
         camera.setViewFromTransform(viewerObject.transform.translation, viewerObject.transform.rotation);
         
+        applyProjection(camera, projectionType, aspect);
+    }
+
+    void FirstApp::applyProjection(LotCamera& camera, KeyboardMoveCtrl::ProjectionType projectionType, float aspect) {
         // 투영 설정 (기존 유지)
         if (projectionType == KeyboardMoveCtrl::ProjectionType::Perspective) {
             camera.setPerspectiveProjection(glm::radians(50.f), aspect, 0.1f, 10.f);
@@ -154,25 +756,173 @@ namespace lot {
         }
     }
 
-    void FirstApp::handleResizing() {
-        // 리사이징 중에는 간단한 클리어만 수행
-        if (auto commandBuffer = lotRenderer.beginFrame()) {
-            lotRenderer.beginSwapChainRenderPass(commandBuffer);
-            lotRenderer.endSwapChainRenderPass(commandBuffer);
+    float FirstApp::getWindowAspectRatio() {
+        // 메인 스레드는 스왑체인 대신 창 크기로 종횡비를 계산 (스왑체인은 렌더 스레드 소유)
+        VkExtent2D extent = lotWindow->getExtent();
+        if (extent.width == 0 || extent.height == 0) {
+            return 1.0f;
         }
-        lotRenderer.endFrame();
-
-        // 리사이징 중에는 더 자주 폴링
-        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        return static_cast<float>(extent.width) / static_cast<float>(extent.height);
     }
 
-    void FirstApp::render(SimpleRenderSystem& renderSystem, LotCamera& camera) {
-        if (auto commandBuffer = lotRenderer.beginFrame()) {
-            lotRenderer.beginSwapChainRenderPass(commandBuffer);
-            renderSystem.renderGameObjects(commandBuffer, gameObjects, camera);
-            renderSystem.renderHighlights(commandBuffer, gameObjects, camera);
-            lotRenderer.endSwapChainRenderPass(commandBuffer);
-            lotRenderer.endFrame();
+    void FirstApp::render(SimpleRenderSystem& renderSystem, const FrameSnapshot& snapshot,
+                          RenderThreadResources& resources) {
+        LOT_PROFILE_SCOPE("FirstApp::render");
+        auto& flightRecorder = *resources.flightRecorder;
+        flightRecorder.beginFrame();
+        flightRecorder.beginPhase("beginFrame");
+        auto commandBuffer = lotRenderer.beginFrame();
+        if (!commandBuffer) {
+            // 최소화 또는 스왑체인 재생성으로 프레임을 건너뜀
+            flightRecorder.endFrame();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return;
+        }
+        flightRecorder.beginPhase("prepare");
+
+        // 스왑체인 포맷이 바뀌어 렌더 패스가 새로 만들어졌으면 기록 전에 파이프라인을 다시 만듦
+        if (resources.renderPassVersion != lotRenderer.getRenderPassVersion()) {
+            renderSystem.recreatePipelines(lotRenderer.getSwapChainRenderPass());
+            resources.renderPassVersion = lotRenderer.getRenderPassVersion();
+        }
+
+        int frameIndex = lotRenderer.getFrameIndex();
+        // 이 슬롯의 이전 프레임이 쓴 임시 메모리는 펜스 대기 후이므로 버려도 됨
+        LotFrameArena& frameArena = *resources.frameArenas[frameIndex];
+        frameArena.reset();
+
+        // 이 프레임 슬롯의 펜스는 beginFrame에서 이미 대기했으므로 이전 참조를 해제해도 안전
+        // 장면이 그대로면 같은 모델 집합이므로 다시 모을 필요가 없음
+        if (resources.retainedSceneVersions[frameIndex] != snapshot.sceneVersion) {
+            auto& retainedModels = resources.inFlightModels[frameIndex];
+            retainedModels.clear();
+            for (const auto& obj : snapshot.objects) {
+                retainedModels.push_back(obj.model);
+            }
+            resources.retainedSceneVersions[frameIndex] = snapshot.sceneVersion;
+        }
+
+        // 렌더 스레드는 실제 스왑체인 종횡비로 투영을 다시 계산 (리사이즈 중에도 왜곡 없음)
+        LotCamera camera = snapshot.camera;
+        applyProjection(camera, snapshot.projectionType, lotRenderer.getAspectRatio());
+
+        // 카메라와 트랜스폼은 버퍼로만 전달되므로 움직이기만 한 프레임은 기록된 커맨드를 그대로 재사용
+        // 카메라 행렬은 제출 직전에 채움 (아래 endFrame의 late latch)
+        VkExtent2D extent = lotRenderer.getSwapChainExtent();
+        GlobalUbo ubo{};
+        ubo.viewportSize = {
+            static_cast<float>(extent.width), static_cast<float>(extent.height),
+            1.0f / static_cast<float>(std::max(extent.width, 1u)),
+            1.0f / static_cast<float>(std::max(extent.height, 1u)) };
+        ubo.time = std::chrono::duration<float>(std::chrono::steady_clock::now() - resources.startTime).count();
+        ubo.frameTime = snapshot.frameTime;
+        ubo.frameNumber = static_cast<uint32_t>(snapshot.frameNumber);
+
+        // 객체 데이터는 snapshot.objects와 같은 순서로 채우며, 드로우는 이 인덱스를 푸시함
+        ensureObjectBufferCapacity(resources, frameIndex, snapshot.objects.size());
+        auto* objectData = static_cast<ObjectData*>(resources.objectBuffers[frameIndex]->getMappedMemory());
+        // 지표용 삼각형/하이라이트 드로우 수도 같은 순회에서 구간별로 합산
+        std::atomic<uint64_t> triangleCount{0};
+        std::atomic<uint64_t> selectedCount{0};
+        LotJobSystem::instance().parallelFor(snapshot.objects.size(), TRANSFORM_GRAIN_SIZE,
+            [&](size_t begin, size_t end) {
+                uint64_t triangles = 0;
+                uint64_t selected = 0;
+                for (size_t i = begin; i < end; i++) {
+                    const auto& obj = snapshot.objects[i];
+                    ObjectData data{};
+                    data.modelMatrix = obj.modelMatrix;
+                    data.color = glm::vec4(obj.color, 1.0f);
+                    data.isSelected = obj.isSelected ? 1 : 0;
+                    objectData[i] = data;
+
+                    triangles += obj.model->getTriangleCount() * (obj.isSelected ? 2u : 1u);
+                    selected += obj.isSelected ? 1 : 0;
+                }
+                triangleCount.fetch_add(triangles, std::memory_order_relaxed);
+                selectedCount.fetch_add(selected, std::memory_order_relaxed);
+            });
+
+        FrameInfo frameInfo{
+            frameIndex, snapshot.frameTime, commandBuffer, camera,
+            lotRenderer.getSwapChainRenderPass(), lotRenderer.getCurrentFramebuffer(),
+            extent, lotRenderer.getThreadCommandPools(),
+            resources.globalDescriptorSets[frameIndex], snapshot.sceneVersion,
+            resources.descriptorVersions[frameIndex], frameArena };
+
+        // 이 슬롯의 펜스는 beginFrame에서 기다렸으므로 이전 쿼리 결과를 대기 없이 회수
+        flightRecorder.beginPhase("record");
+        auto& gpuProfiler = *resources.gpuProfiler;
+        gpuProfiler.beginFrame(commandBuffer, frameIndex, snapshot.frameNumber, frameInfo.renderPass);
+
+        // 렌더 시스템은 보조 커맨드 버퍼에 병렬로 기록하고 주 커맨드 버퍼는 실행만 함
+        constexpr VkSubpassContents secondaryContents = VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
+        uint32_t passScope = gpuProfiler.beginScope(commandBuffer, "renderPass");
+        lotRenderer.beginSwapChainRenderPass(commandBuffer, secondaryContents);
+
+        uint32_t objectsScope = gpuProfiler.beginScope(commandBuffer, "renderGameObjects", secondaryContents);
+        renderSystem.renderGameObjects(frameInfo, snapshot.objects);
+        gpuProfiler.endScope(commandBuffer, objectsScope, secondaryContents);
+
+        // 하이라이트 패스는 선택된 객체를 한 번 더 그림
+        uint32_t highlightsScope = gpuProfiler.beginScope(commandBuffer, "renderHighlights", secondaryContents);
+        renderSystem.renderHighlights(frameInfo, snapshot.objects);
+        gpuProfiler.endScope(commandBuffer, highlightsScope, secondaryContents);
+
+        lotRenderer.endSwapChainRenderPass(commandBuffer);
+        gpuProfiler.endScope(commandBuffer, passScope);
+        gpuProfiler.endFrame(commandBuffer);
+        flightRecorder.beginPhase("endFrame");
+        auto inputTime = snapshot.inputTime;
+        lotRenderer.endFrame([&] {
+            // 이미지 펜스 대기까지 끝난 시점에 메인 스레드가 마지막으로 읽은 입력의 카메라를 사용
+            // 이 슬롯의 UBO는 beginFrame에서 펜스를 기다렸으므로 GPU가 읽고 있지 않음
+            LotCamera latchedCamera = camera;
+            if (options.lateLatchCamera) {
+                cameraLatch.acquire();
+                const auto& latched = cameraLatch.readBuffer();
+                if (latched.inputTime > inputTime) {
+                    latchedCamera = latched.camera;
+                    applyProjection(latchedCamera, latched.projectionType, lotRenderer.getAspectRatio());
+                    inputTime = latched.inputTime;
+                }
+            }
+            ubo.projection = latchedCamera.getProjection();
+            ubo.view = latchedCamera.getView();
+            ubo.inverseView = glm::inverse(ubo.view);
+            ubo.projectionView = ubo.projection * ubo.view;
+            resources.uboRing->writeToIndex(&ubo, frameIndex);
+        });
+        flightRecorder.endFrame();
+        // 같은 스냅샷을 다시 그린 프레임은 새 스냅샷을 받았거나 late latch로 입력이 앞당겨졌을 때만 보고
+        // (그렇지 않으면 이미 보고한 입력 시각으로 지연이 계속 늘어난 것처럼 기록됨)
+        if (snapshot.frameNumber > resources.presentedFrameNumber || inputTime > resources.presentedInputTime) {
+            framePacer.framePresented(snapshot.frameNumber, inputTime);
+            resources.presentedFrameNumber = std::max(resources.presentedFrameNumber, snapshot.frameNumber);
+            resources.presentedInputTime = std::max(resources.presentedInputTime, inputTime);
+        }
+
+        auto& metrics = renderMetrics();
+        metrics.framesRendered.add();
+        metrics.objects.set(static_cast<double>(snapshot.objects.size()));
+        metrics.drawCalls.set(static_cast<double>(snapshot.objects.size() + selectedCount.load()));
+        metrics.triangles.set(static_cast<double>(triangleCount.load()));
+        metrics.heapAllocations.set(static_cast<double>(resources.flightRecorder->getLastFrame().allocations));
+
+        auto frameEnd = std::chrono::steady_clock::now();
+        if (resources.lastFrameEnd != std::chrono::steady_clock::time_point{}) {
+            metrics.frameTimeMs.observe(
+                std::chrono::duration<double, std::milli>(frameEnd - resources.lastFrameEnd).count());
+            resources.fpsWindowFrames++;
+        } else {
+            resources.fpsWindowStart = frameEnd;
+        }
+        resources.lastFrameEnd = frameEnd;
+        if (frameEnd - resources.fpsWindowStart >= FPS_WINDOW) {
+            metrics.fps.set(resources.fpsWindowFrames /
+                            std::chrono::duration<double>(frameEnd - resources.fpsWindowStart).count());
+            resources.fpsWindowStart = frameEnd;
+            resources.fpsWindowFrames = 0;
         }
     }
 
@@ -181,35 +931,28 @@ namespace lot {
         static auto lastInfoTime = std::chrono::high_resolution_clock::now();
         static auto lastCameraDebug = std::chrono::high_resolution_clock::now();
 
-        // 씬 정보 출력 (5초마다)
+        // 씬 정보 출력 (5초마다, 객체별 줄은 TRACE 레벨에서만 컴파일됨)
         if (std::chrono::duration_cast<std::chrono::seconds>(currentTime - lastInfoTime).count() >= 5) {
-            std::cout << "=== Scene Info ===" << std::endl;
-            std::cout << "Total objects: " << gameObjects.size() << std::endl;
-
             int selectedCount = 0;
             for (const auto& obj : gameObjects) {
                 if (obj.isSelected) selectedCount++;
-                std::cout << "Object ID " << obj.getId()
-                          << " - Pos: (" << obj.transform.translation.x << ", "
-                          << obj.transform.translation.y << ", " << obj.transform.translation.z
-                          << "), Scale: (" << obj.transform.scale.x << ", "
-                          << obj.transform.scale.y << ", " << obj.transform.scale.z
-                          << "), Selected: " << (obj.isSelected ? "Yes" : "No") << std::endl;
+                LOT_LOG_TRACE("Object ID {} - Pos: ({}, {}, {}), Scale: ({}, {}, {}), Selected: {}",
+                              obj.getId(), obj.transform.translation.x, obj.transform.translation.y,
+                              obj.transform.translation.z, obj.transform.scale.x, obj.transform.scale.y,
+                              obj.transform.scale.z, obj.isSelected ? "Yes" : "No");
             }
 
-            std::cout << "Selected objects: " << selectedCount << "/" << gameObjects.size() << std::endl;
-            std::cout << "==================" << std::endl;
+            LOT_LOG_DEBUG("Scene Info - Total objects: {}, Selected objects: {}", gameObjects.size(), selectedCount);
             lastInfoTime = currentTime;
         }
 
         // 카메라 디버그 정보 출력 (5초마다)
         if (std::chrono::duration_cast<std::chrono::seconds>(currentTime - lastCameraDebug).count() >= 5) {
-            std::cout << "Camera Position: (" << viewerObject.transform.translation.x << ", "
-                      << viewerObject.transform.translation.y << ", " << viewerObject.transform.translation.z << ")" << std::endl;
-            std::cout << "Camera Rotation (Quat): w=" << viewerObject.transform.rotation.w 
-                      << " x=" << viewerObject.transform.rotation.x 
-                      << " y=" << viewerObject.transform.rotation.y 
-                      << " z=" << viewerObject.transform.rotation.z << std::endl;
+            LOT_LOG_DEBUG("Camera Position: ({}, {}, {})", viewerObject.transform.translation.x,
+                          viewerObject.transform.translation.y, viewerObject.transform.translation.z);
+            LOT_LOG_DEBUG("Camera Rotation (Quat): w={} x={} y={} z={}", viewerObject.transform.rotation.w,
+                          viewerObject.transform.rotation.x, viewerObject.transform.rotation.y,
+                          viewerObject.transform.rotation.z);
             lastCameraDebug = currentTime;
         }
     }
@@ -308,6 +1051,19 @@ namespace lot {
         gameObjects.push_back(std::move(obj));
     }
 
+    void FirstApp::loadBenchmarkScene() {
+        const LotBenchmarkConfig& config = options.benchmarkConfig;
+        std::shared_ptr<LotModel> model;
+        float modelScale = 1.f;
+        if (config.shape == LotBenchmarkConfig::Shape::Vase) {
+            model = LotModel::createModelFromFile(lotDevice, "models/smooth_vase.obj");
+            modelScale = 3.f;
+        } else {
+            model = createCubeMode(lotDevice, {.0f, .0f, .0f});
+        }
+        LotBenchmark::generateScene(config, model, modelScale, gameObjects);
+    }
+
     void FirstApp::addNewCube() {
         std::shared_ptr<LotModel> lotModel = createCubeMode(lotDevice, {.0f, .0f, .0f});
 
@@ -330,6 +1086,7 @@ namespace lot {
         };
 
         gameObjects.push_back(std::move(newCube));
+        markSceneChanged();
     }
 
     void FirstApp::removeSelectedObjects() {
@@ -340,5 +1097,6 @@ namespace lot {
         );
 
         selectionManager.clearAllSelections(gameObjects);
+        markSceneChanged();
     }
 } // namespce lot
\ No newline at end of file
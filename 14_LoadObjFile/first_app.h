@@ -1,27 +1,71 @@
 #pragma once
 
+#include "lot_benchmark.h"
+#include "lot_buffer.h"
+#include "lot_descriptors.h"
 #include "lot_device.h"
+#include "lot_flight_recorder.h"
+#include "lot_frame_pacer.h"
 #include "lot_game_object.h"
+#include "lot_gpu_profiler.h"
+#include "lot_input.h"
+#include "lot_metrics_server.h"
+#include "lot_pipeline_manager.h"
 #include "lot_renderer.h"
 #include "lot_window.h"
 #include "object_selection_manager.h"
 #include "keyboard_move_ctrl.h"
 #include "lot_camera.h"
+#include "lot_frame_info.h"
+#include "lot_swap_chain.h"
+#include "lot_triple_buffer.h"
 #include "simple_render_system.h"
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 #include <chrono>
 
 #include <glm/glm.hpp>
 
 namespace lot {
+    struct FirstAppOptions {
+        // 창 없이 오프스크린 타깃에 headlessFrames 프레임을 렌더링하고 프레임 시간을 보고
+        bool headless{false};
+        uint32_t headlessFrames{1000};
+        VkExtent2D headlessExtent{800, 600};
+        // 입력 대신 생성한 장면과 정해진 카메라 경로로 headlessFrames 프레임을 렌더링하고 JSON 보고서 저장
+        // (headless와 함께 쓰면 오프스크린, 아니면 창에 렌더링)
+        bool benchmark{false};
+        LotBenchmarkConfig benchmarkConfig{};
+        // 입력을 파일에 기록하거나, 기록한 입력을 replayTimestep 고정 간격으로 재생 (재생이 끝나면 종료)
+        std::string recordInputPath;
+        std::string replayInputPath;
+        float replayTimestep{LotInput::DEFAULT_REPLAY_TIMESTEP};
+        // 장면/카메라/선택이 바뀌었거나 입력이 눌려 있을 때만 렌더링하고, 그 외에는 이벤트를 기다림
+        // (창이 포커스를 잃으면 프레임 수를 제한하고, 최소화되면 렌더링하지 않음. 입력 재생 중에는 무시)
+        bool renderOnDemand{false};
+        // 프레젠트 모드/스왑체인 이미지 수/동시 진행 프레임 수
+        LotSwapChain::Config swapChainConfig{};
+        // 입력 스레드의 run-ahead와 프레임률 제한 (기본은 제한 없음)
+        LotFramePacerConfig framePacerConfig{};
+        // 카메라 유니폼을 스냅샷 대신 제출 직전의 최신 카메라로 씀 (입력 ~ 화면 지연 단축)
+        bool lateLatchCamera{true};
+    };
+
     class FirstApp {
         public:
             static constexpr int WIDTH = 800;
             static constexpr int HEIGHT = 600;
 
-            FirstApp();
+            FirstApp() : FirstApp(FirstAppOptions{}) {}
+            explicit FirstApp(const FirstAppOptions& options);
             ~FirstApp();
 
             FirstApp(const FirstApp &) = delete;
@@ -31,26 +75,111 @@ namespace lot {
 
         private:
             void loadGameObjects();
+            void loadBenchmarkScene();
             void addNewCube();
             void removeSelectedObjects();
 
             // 메인 루프 함수들
-            void updateCamera(KeyboardMoveCtrl& cameraCtrl, float frameTime,
+            void updateCamera(LotInput& input, KeyboardMoveCtrl& cameraCtrl, float frameTime,
                              LotGameObject& viewerObject, glm::vec3& orbitTarget,
                              KeyboardMoveCtrl::ProjectionType projectionType);
-            void handleInputs(const std::chrono::high_resolution_clock::time_point& currentTime, const LotGameObject& viewerObject, LotCamera& camera);
+            void handleInputs(LotInput& input, const std::chrono::high_resolution_clock::time_point& currentTime, const LotGameObject& viewerObject, LotCamera& camera);
             void updateProjection(LotCamera& camera, KeyboardMoveCtrl::ProjectionType projectionType, float aspect, const LotGameObject& viewerObject, const glm::vec3& orbitTarget);
-            void handleResizing();
-            void render(SimpleRenderSystem& renderSystem, LotCamera& camera);
+            static void applyProjection(LotCamera& camera, KeyboardMoveCtrl::ProjectionType projectionType, float aspect);
+            float getWindowAspectRatio();
             void printDebugInfo(const std::chrono::high_resolution_clock::time_point& currentTime,
                                const LotGameObject& viewerObject);
 
-            LotWindow lotWindow{ WIDTH, HEIGHT, "Hellow Lot Vulkan!!!" };
-            LotDevice lotDevice{ lotWindow };
-            LotRenderer lotRenderer{ lotWindow, lotDevice };
+            // 메인 스레드 -> 렌더 스레드 스냅샷 교환
+            void fillFrameSnapshot(FrameSnapshot& snapshot, const LotCamera& camera,
+                                   KeyboardMoveCtrl::ProjectionType projectionType, float frameTime);
+            void publishFrameSnapshot(const LotCamera& camera, KeyboardMoveCtrl::ProjectionType projectionType,
+                                      float frameTime, std::chrono::steady_clock::time_point inputTime);
+            void waitForSnapshotConsumed();
+            // 렌더 스레드: 새 스냅샷을 가져갔으면 메인 스레드를 깨움
+            void notifySnapshotConsumed(bool acquired);
+            void publishLatchedCamera(const LotCamera& camera, KeyboardMoveCtrl::ProjectionType projectionType,
+                                      std::chrono::steady_clock::time_point inputTime);
+            // 온디맨드 모드: 최소화/포커스 해제 시 프레임 간격을 늘리고, 유휴 상태면 이벤트가 올 때까지 대기
+            void throttleMainLoop(bool idle, std::chrono::steady_clock::time_point lastFrameStart);
+
+            // 객체 추가/삭제/선택/회전 시 호출: 렌더 스레드의 커맨드 버퍼 캐시를 무효화
+            // (객체를 움직이는 코드는 모두 호출, 벤치마크 애니메이션처럼 매 프레임 움직이는 경우만 예외:
+            //  트랜스폼은 객체 버퍼로 전달되므로 캐시된 커맨드 버퍼도 최신 위치로 그려짐)
+            void markSceneChanged() { sceneVersion++; }
+
+            // 렌더 스레드
+            using InFlightModels = std::array<std::vector<std::shared_ptr<LotModel>>, LotSwapChain::MAX_FRAMES_IN_FLIGHT>;
+
+            // 렌더 스레드가 소유하는 프레임 슬롯별 자원
+            struct RenderThreadResources {
+                std::unique_ptr<LotDescriptorPool> globalPool;
+                std::unique_ptr<LotDescriptorSetLayout> globalSetLayout;
+                // 프레임 슬롯마다 GlobalUbo 인스턴스 하나씩 (영구 매핑된 링 버퍼)
+                std::unique_ptr<LotBuffer> uboRing;
+                // 프레임 슬롯별 객체 데이터 스토리지 버퍼 (객체 수에 맞춰 증가)
+                std::array<std::unique_ptr<LotBuffer>, LotSwapChain::MAX_FRAMES_IN_FLIGHT> objectBuffers;
+                std::array<VkDescriptorSet, LotSwapChain::MAX_FRAMES_IN_FLIGHT> globalDescriptorSets{};
+                std::array<uint64_t, LotSwapChain::MAX_FRAMES_IN_FLIGHT> descriptorVersions{};
+                std::chrono::steady_clock::time_point startTime{};
+                // 렌더 패스/렌더 시스템 구간별 GPU 시간 (LOT_GPU_PROFILE 경로로 종료 시 저장)
+                std::unique_ptr<LotGpuProfiler> gpuProfiler;
+                // 렌더 스레드 프레임 히치 기록 (LOT_HITCH_MS를 넘으면 최근 프레임들을 저장)
+                std::unique_ptr<LotFlightRecorder> flightRecorder;
+                // FPS/프레임 시간 지표 계산용
+                std::chrono::steady_clock::time_point lastFrameEnd{};
+                std::chrono::steady_clock::time_point fpsWindowStart{};
+                uint32_t fpsWindowFrames{0};
+                // 프레임 페이서에 마지막으로 보고한 스냅샷 번호와 입력 시각
+                uint64_t presentedFrameNumber{0};
+                std::chrono::steady_clock::time_point presentedInputTime{};
+
+                InFlightModels inFlightModels{};
+                std::array<uint64_t, LotSwapChain::MAX_FRAMES_IN_FLIGHT> retainedSceneVersions{};
+                // 프레임 슬롯별 임시 메모리 (슬롯 펜스를 기다린 뒤 비움)
+                std::array<std::unique_ptr<LotFrameArena>, LotSwapChain::MAX_FRAMES_IN_FLIGHT> frameArenas;
+                // 렌더 시스템 파이프라인을 만든 렌더 패스 (LotRenderer::getRenderPassVersion)
+                uint64_t renderPassVersion{0};
+            };
+
+            void startRenderThread();
+            void stopRenderThread();
+            void createRenderThreadResources(RenderThreadResources& resources);
+            void ensureObjectBufferCapacity(RenderThreadResources& resources, int frameIndex, size_t objectCount);
+            void writeGlobalDescriptorSet(RenderThreadResources& resources, int frameIndex);
+            static void dumpGpuProfile(RenderThreadResources& resources);
+            void renderLoop();
+            // 입력/렌더 스레드 없이 호출 스레드에서 고정 카메라로 렌더링 후 프레임 시간 보고
+            void runHeadless();
+            // 벤치마크 모드: 입력/렌더 스레드 없이 호출 스레드에서 렌더링하며 구간별 시간과 메모리를 수집
+            void runBenchmark();
+            void render(SimpleRenderSystem& renderSystem, const FrameSnapshot& snapshot, RenderThreadResources& resources);
+
+            FirstAppOptions options;
+            // 헤드리스 모드에서는 nullptr
+            std::unique_ptr<LotWindow> lotWindow;
+            LotDevice lotDevice;
+            LotRenderer lotRenderer;
+            LotFramePacer framePacer;
 
             std::vector<LotGameObject> gameObjects;
             ObjectSelectionManager selectionManager;
+
+            LotTripleBuffer<FrameSnapshot> frameSnapshots;
+            LotTripleBuffer<LatchedCamera> cameraLatch;
+            // 렌더 스레드는 새 스냅샷을, 메인 스레드는 스냅샷을 가져가길 기다릴 때 사용 (폴링 없음)
+            std::mutex snapshotMutex;
+            std::condition_variable snapshotPublished;
+            std::condition_variable snapshotConsumed;
+            uint64_t frameCounter{0};
+            uint64_t sceneVersion{1};
+
+            std::thread renderThread;
+            std::atomic<bool> renderThreadRunning{false};
+            std::exception_ptr renderThreadError;
+
+            // LOT_METRICS_SOCKET / LOT_METRICS_HTTP_PORT가 지정된 경우에만 생성
+            std::unique_ptr<LotMetricsServer> metricsServer;
     };
 
 } // namespace lot
\ No newline at end of file
@@ -1,5 +1,5 @@
 #include "keyboard_move_ctrl.h"
-#include <iostream>
+#include "lot_log.h"
 
 // GLM 실험적 확장 기능 활성화
 #define GLM_ENABLE_EXPERIMENTAL
@@ -12,28 +12,27 @@
 #include <limits>
 
 namespace lot {
-    KeyboardMoveCtrl* KeyboardMoveCtrl::instance = nullptr;
     // 임시 함수
-    void KeyboardMoveCtrl::rotateObjectsTest(GLFWwindow* window, float dt, LotGameObject& gameObject) {
+    void KeyboardMoveCtrl::rotateObjectsTest(LotInput& input, float dt, LotGameObject& gameObject) {
         glm::vec3 rotationDelta{0.0f};
 
         // 넘패드 입력으로 회전
-        if (glfwGetKey(window, keys.objRotateLeft) == GLFW_PRESS) { // Y축 왼쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRotateLeft)) { // Y축 왼쪽 회전
             rotationDelta.y -= objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRotateRight) == GLFW_PRESS) { // Y축 오른쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRotateRight)) { // Y축 오른쪽 회전
             rotationDelta.y += objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRotateUp) == GLFW_PRESS) { // X축 위쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRotateUp)) { // X축 위쪽 회전
             rotationDelta.x -= objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRotateDown) == GLFW_PRESS) { // X축 아래쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRotateDown)) { // X축 아래쪽 회전
             rotationDelta.x += objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRollLeft) == GLFW_PRESS) { // Z축 롤 왼쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRollLeft)) { // Z축 롤 왼쪽 회전
             rotationDelta.z -= objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRollRight) == GLFW_PRESS) { // Z축 롤 오른쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRollRight)) { // Z축 롤 오른쪽 회전
             rotationDelta.z += objectRotationSpeed * dt;
         }
 
@@ -51,15 +50,15 @@ namespace lot {
     }
 
     // 제어 함수
-    void KeyboardMoveCtrl::moveInPlaneXZ(GLFWwindow* window, float dt, LotGameObject& gameObject) {
+    void KeyboardMoveCtrl::moveInPlaneXZ(LotInput& input, float dt, LotGameObject& gameObject) {
         glm::vec3 rotate{0};
-        if (glfwGetKey(window, keys.lookRight) == GLFW_PRESS) rotate.y += 1.f;
-        if (glfwGetKey(window, keys.lookLeft) == GLFW_PRESS) rotate.y -= 1.f;
-        if (glfwGetKey(window, keys.lookUp) == GLFW_PRESS) rotate.x += 1.f;
-        if (glfwGetKey(window, keys.lookDown) == GLFW_PRESS) rotate.x -= 1.f;
+        if (input.isActionDown(LotInputAction::LookRight)) rotate.y += 1.f;
+        if (input.isActionDown(LotInputAction::LookLeft)) rotate.y -= 1.f;
+        if (input.isActionDown(LotInputAction::LookUp)) rotate.x += 1.f;
+        if (input.isActionDown(LotInputAction::LookDown)) rotate.x -= 1.f;
 
         if (glm::dot(rotate, rotate) > std::numeric_limits<float>::epsilon()) {
-            std::cout << "*** moveInPlaneXZ CHANGING CAMERA - rotate: (" << rotate.x << ", " << rotate.y << ", " << rotate.z << ") ***" << std::endl;
+            LOT_LOG_DEBUG("moveInPlaneXZ changing camera - rotate: ({}, {}, {})", rotate.x, rotate.y, rotate.z);
             //gameObject.transform.rotation += lookSpeed * dt * glm::normalize(rotate);
             glm::vec3 normalizedRotate = glm::normalize(rotate);
             if (normalizedRotate.x != 0.0f) gameObject.transform.rotateAroundAxis(lookSpeed * dt * normalizedRotate.x, glm::vec3(1, 0, 0));
@@ -76,70 +75,58 @@ namespace lot {
         const glm::vec3 upDir = rotMatrix * glm::vec3(0.0f, -1.0f, 0.0f);      // 로컬 Y축
 
         glm::vec3 moveDir{0.f};
-        if (glfwGetKey(window, keys.moveForward) == GLFW_PRESS) moveDir += forwardDir;
-        if (glfwGetKey(window, keys.moveBackward) == GLFW_PRESS) moveDir -= forwardDir;
-        if (glfwGetKey(window, keys.moveRight) == GLFW_PRESS) moveDir += rightDir;
-        if (glfwGetKey(window, keys.moveLeft) == GLFW_PRESS) moveDir -= rightDir;
-        if (glfwGetKey(window, keys.moveUp) == GLFW_PRESS) moveDir += upDir;
-        if (glfwGetKey(window, keys.moveDown) == GLFW_PRESS) moveDir -= upDir;
+        if (input.isActionDown(LotInputAction::MoveForward)) moveDir += forwardDir;
+        if (input.isActionDown(LotInputAction::MoveBackward)) moveDir -= forwardDir;
+        if (input.isActionDown(LotInputAction::MoveRight)) moveDir += rightDir;
+        if (input.isActionDown(LotInputAction::MoveLeft)) moveDir -= rightDir;
+        if (input.isActionDown(LotInputAction::MoveUp)) moveDir += upDir;
+        if (input.isActionDown(LotInputAction::MoveDown)) moveDir -= upDir;
 
         if (glm::dot(moveDir, moveDir) > std::numeric_limits<float>::epsilon()) {
             gameObject.transform.translation += moveSpeed * dt *glm::normalize(moveDir);
         }
     }
 
-    void KeyboardMoveCtrl::rotateObjects(GLFWwindow* window, float dt, std::vector<LotGameObject>& objects) {
+    bool KeyboardMoveCtrl::rotateObjects(LotInput& input, float dt, std::vector<LotGameObject>& objects) {
         if (objects.empty()) {
             hasValidObjectSelection = false;
-            return;
+            return false;
         }
 
-        // 객체 선택 처리
-        bool selectNextPressed = glfwGetKey(window, keys.selectNextObject) == GLFW_PRESS;
-        bool selectPrevPressed = glfwGetKey(window, keys.selectPrevObject) == GLFW_PRESS;
-
-        if (selectNextPressed && !wasSelectNextPressed) {
+        // 객체 선택 처리 (누른 프레임에 한 번만)
+        if (input.isActionPressed(LotInputAction::SelectNextObject)) {
             selectNextObject(objects);
         }
-        if (selectPrevPressed && !wasSelectPrevPressed) {
+        if (input.isActionPressed(LotInputAction::SelectPrevObject)) {
             selectPrevObject(objects);
         }
 
-        wasSelectNextPressed = selectNextPressed;
-        wasSelectPrevPressed = selectPrevPressed;
-
         // 회전 속도 조절
-        bool increaseSpeedPressed = glfwGetKey(window, keys.increaseRotSpeed) == GLFW_PRESS;
-        bool decreaseSpeedPressed = glfwGetKey(window, keys.decreaseRotSpeed) == GLFW_PRESS;
-
-        if (increaseSpeedPressed && !wasIncreaseSpeedPressed) {
+        if (input.isActionPressed(LotInputAction::IncreaseRotationSpeed)) {
             objectRotationSpeed = std::min(objectRotationSpeed + rotationSpeedIncrement, maxRotationSpeed);
-            std::cout << "Object rotation speed : " << objectRotationSpeed << std::endl;
+            LOT_LOG_INFO("Object rotation speed : {}", objectRotationSpeed);
         }
-        if (decreaseSpeedPressed && !wasDecreaseSpeedPressed) {
+        if (input.isActionPressed(LotInputAction::DecreaseRotationSpeed)) {
             objectRotationSpeed = std::max(objectRotationSpeed - rotationSpeedIncrement, minRotationSpeed);
-            std::cout << "Object rotation speed : " << objectRotationSpeed << std::endl;
+            LOT_LOG_INFO("Object rotation speed : {}", objectRotationSpeed);
         }
 
-        wasIncreaseSpeedPressed = increaseSpeedPressed;
-        wasDecreaseSpeedPressed = decreaseSpeedPressed;
-
         // 선택된 객체 없을 시 첫번째 객체 자동 선택
         if (!hasValidObjectSelection) {
             selectObject(0, objects);
         }
 
         // 회전 입력 처리
-        handleKeyboardObjectControl(window, dt, objects);
+        return handleKeyboardObjectControl(input, dt, objects);
     }
 
-    void KeyboardMoveCtrl::handleMouseCameraControl(GLFWwindow* window, float dt, LotGameObject& cameraObject, glm::vec3& targetPoint) {
+    void KeyboardMoveCtrl::handleMouseCameraControl(LotInput& input, float dt, LotGameObject& cameraObject, glm::vec3& targetPoint) {
         // 이 함수 완전 비활성화 - 다른 곳에서 호출되면 문제가 됨
-        std::cout << "*** WARNING: handleMouseCameraControl called - this should not be used ***" << std::endl;
+        LOT_LOG_WARN("handleMouseCameraControl called - this should not be used");
         return;
 
         double currentMouseX, currentMouseY;
-        glfwGetCursorPos(window, &currentMouseX, &currentMouseY);
+        input.getCursorPos(currentMouseX, currentMouseY);
 
         if (firstMouse) {
             lastMouseX = currentMouseX;
@@ -185,7 +172,7 @@ namespace lot {
         if (middleMousePressed) {
             // 화면 크기 정보 가져오기
             int windowWidth, windowHeight;
-            glfwGetWindowSize(window, &windowWidth, &windowHeight);
+            input.getWindowSize(windowWidth, windowHeight);
             
             // 직교 투영 정보 (first_app.cpp에서 설정한 값과 일치해야 함)
             float orthoSize = 2.0f;
@@ -220,15 +207,15 @@ namespace lot {
         lastMouseY = currentMouseY;
     }
 
-    void KeyboardMoveCtrl::handleMouseCameraControlWithProjection(GLFWwindow* window, float dt,
+    void KeyboardMoveCtrl::handleMouseCameraControlWithProjection(LotInput& input, float dt,
                                                                   LotGameObject& cameraObject,
                                                                   glm::vec3& targetPoint,
                                                                   float orthoSize,
                                                                   float aspect) {
-        processMouseInput(window);
+        processMouseInput(input);
 
         double currentMouseX, currentMouseY;
-        glfwGetCursorPos(window, &currentMouseX, &currentMouseY);
+        input.getCursorPos(currentMouseX, currentMouseY);
 
         if (firstMouse) {
             lastMouseX = currentMouseX;
@@ -286,7 +273,7 @@ namespace lot {
         if (middleMousePressed) {
             // 화면 크기 정보 가져오기
             int windowWidth, windowHeight;
-            glfwGetWindowSize(window, &windowWidth, &windowHeight);
+            input.getWindowSize(windowWidth, windowHeight);
             
             // 매개변수로 받은 투영 정보 사용
             // 월드 공간 크기 계산
@@ -318,24 +305,13 @@ namespace lot {
         lastMouseY = currentMouseY;
     }
 
-    // 스크롤 콜백 함수 (static)
-    void KeyboardMoveCtrl::scrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
-        if (instance) {
-            instance->setScrollDelta(yoffset);
-        }
-    }
-
-    // 마우스 콜백 함수 (static) - 비활성화 (glfwGetCursorPos 사용)
-    void KeyboardMoveCtrl::mouseCallback(GLFWwindow* window, double xpos, double ypos) {
-        // 콜백 방식 비활성화 - 직접 glfwGetCursorPos 사용
-        return;
-    }
-
-    void KeyboardMoveCtrl::processScrollInput(GLFWwindow* window, ProjectionType projType,
+    void KeyboardMoveCtrl::processScrollInput(LotInput& input, ProjectionType projType,
                                          float& orthoSize, LotGameObject& cameraObject,
                                          glm::vec3& targetPoint, float fov) {
+        // 스크롤 콜백은 LotInput이 받아 프레임 단위로 모아 둠
+        double scrollDelta = input.getScrollDelta();
         if (abs(scrollDelta) < 0.001) return;  // 스크롤이 없으면 리턴
-        std::cout << "*** processScrollInput called - scrollDelta: " << scrollDelta << " ***" << std::endl;
+        LOT_LOG_DEBUG("processScrollInput called - scrollDelta: {}", scrollDelta);
         
         switch (projType) {
             case ProjectionType::Orthographic: {
@@ -368,16 +344,10 @@ namespace lot {
                 break;
             }
         }
-        
-        scrollDelta = 0.0;  // 스크롤 델타 리셋
-    }
-
-    void KeyboardMoveCtrl::setInstance(KeyboardMoveCtrl* inst) {
-        instance = inst;
     }
 
     // 내부 헬퍼 함수
-    void KeyboardMoveCtrl::handleKeyboardObjectControl(GLFWwindow* window, float dt, std::vector<LotGameObject>& gameObject) {
+    bool KeyboardMoveCtrl::handleKeyboardObjectControl(LotInput& input, float dt, std::vector<LotGameObject>& gameObject) {
         //if (!hasValidObjectSelection || selectedObjectIndex >= gameObject.size()) {
         //    return;
         //}
@@ -386,26 +356,27 @@ namespace lot {
         glm::vec3 rotationDelta{0.0f};        
 
         // 넘패드 입력으로 회전
-        if (glfwGetKey(window, keys.objRotateLeft) == GLFW_PRESS) { // Y축 왼쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRotateLeft)) { // Y축 왼쪽 회전
             rotationDelta.y -= objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRotateRight) == GLFW_PRESS) { // Y축 오른쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRotateRight)) { // Y축 오른쪽 회전
             rotationDelta.y += objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRotateUp) == GLFW_PRESS) { // Y축 위쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRotateUp)) { // Y축 위쪽 회전
             rotationDelta.x -= objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRotateDown) == GLFW_PRESS) { // Y축 아래쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRotateDown)) { // Y축 아래쪽 회전
             rotationDelta.x += objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRollLeft) == GLFW_PRESS) { // Z축 롤 왼쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRollLeft)) { // Z축 롤 왼쪽 회전
             rotationDelta.z -= objectRotationSpeed * dt;
         }
-        if (glfwGetKey(window, keys.objRollRight) == GLFW_PRESS) { // Z축 롤 오른쪽 회전
+        if (input.isActionDown(LotInputAction::ObjectRollRight)) { // Z축 롤 오른쪽 회전
             rotationDelta.z += objectRotationSpeed * dt;
         }
 
         // 회전 적용
+        bool rotated = false;
         if (glm::dot(rotationDelta, rotationDelta) > std::numeric_limits<float>::epsilon()) {
             for (auto& obj : gameObject) {
                 if (obj.isSelected) {
@@ -413,21 +384,16 @@ namespace lot {
                     if (rotationDelta.x != 0.0f) obj.transform.rotateAroundAxis(rotationDelta.x, glm::vec3(1, 0, 0));
                     if (rotationDelta.y != 0.0f) obj.transform.rotateAroundAxis(rotationDelta.y, glm::vec3(0, 1, 0));
                     if (rotationDelta.z != 0.0f) obj.transform.rotateAroundAxis(rotationDelta.z, glm::vec3(0, 0, 1));
+                    rotated = true;
                 }
             }
-        }        
+        }
+        return rotated;
     }
 
-    void KeyboardMoveCtrl::processMouseInput(GLFWwindow* window) {
-        int rightMouseState = glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_RIGHT);
-
-        rightMousePressed = (rightMouseState == GLFW_PRESS);
-
-        int middleMouseState = glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_MIDDLE);
-        middleMousePressed = (middleMouseState == GLFW_PRESS);
-
-        wasRightPressed = rightMousePressed;
-        wasMiddlePressed = middleMousePressed;
+    void KeyboardMoveCtrl::processMouseInput(LotInput& input) {
+        rightMousePressed = input.isActionDown(LotInputAction::OrbitCamera);
+        middleMousePressed = input.isActionDown(LotInputAction::PanCamera);
     }
 
     // 객체 선택 함수
@@ -1,65 +1,29 @@
 #pragma once
 
 #include "lot_game_object.h"
-#include "lot_window.h"
+#include "lot_input.h"
 
 // GLM 쿼터니언 지원
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/quaternion.hpp>
 
-#include <iostream>
-
 namespace lot {
     class KeyboardMoveCtrl {
         public:
-            struct KeyMappings {
-                int moveLeft = GLFW_KEY_A;
-                int moveRight = GLFW_KEY_D;
-                int moveForward = GLFW_KEY_W;
-                int moveBackward = GLFW_KEY_S;
-                int moveUp = GLFW_KEY_Q;
-                int moveDown = GLFW_KEY_E;
-
-                int lookLeft = GLFW_KEY_LEFT;
-                int lookRight = GLFW_KEY_RIGHT;
-                int lookUp = GLFW_KEY_UP;
-                int lookDown = GLFW_KEY_DOWN;
-
-                // 객체 회전 (넘패드 - 새로 추가)
-                int objRotateLeft = GLFW_KEY_KP_4;      // Y축 음수 회전
-                int objRotateRight = GLFW_KEY_KP_6;     // Y축 양수 회전  
-                int objRotateUp = GLFW_KEY_KP_8;        // X축 음수 회전
-                int objRotateDown = GLFW_KEY_KP_2;      // X축 양수 회전
-                int objRollLeft = GLFW_KEY_KP_7;        // Z축 음수 회전
-                int objRollRight = GLFW_KEY_KP_9;       // Z축 양수 회전
-                
-                // 객체 선택
-                int selectNextObject = GLFW_KEY_KP_ADD;
-                int selectPrevObject = GLFW_KEY_KP_SUBTRACT;
-                
-                // 속도 조절
-                int increaseRotSpeed = GLFW_KEY_KP_MULTIPLY;
-                int decreaseRotSpeed = GLFW_KEY_KP_DIVIDE;
-            };
-
             enum class ProjectionType {
                 Orthographic,
                 Perspective
             };
 
-            // 생성자
-            KeyboardMoveCtrl() {
-                std::cout << "KeyboardMoveCtrl constructor called" << std::endl;
-            }
-
             // 제어 함수
-            void moveInPlaneXZ(GLFWwindow* window, float dt, LotGameObject& gameObject);
-            void rotateObjects(GLFWwindow* window, float dt, std::vector<LotGameObject>& objects);
-            void handleMouseCameraControl(GLFWwindow* window, float dt, LotGameObject& cameraObject, glm::vec3& targetPoint);
+            void moveInPlaneXZ(LotInput& input, float dt, LotGameObject& gameObject);
+            // 선택된 객체의 트랜스폼을 바꿨으면 true
+            bool rotateObjects(LotInput& input, float dt, std::vector<LotGameObject>& objects);
+            void handleMouseCameraControl(LotInput& input, float dt, LotGameObject& cameraObject, glm::vec3& targetPoint);
             // 투영 정보를 받는 새로운 함수 추가
             void handleMouseCameraControlWithProjection(
-                GLFWwindow* window, 
+                LotInput& input,
                 float dt, 
                 LotGameObject& cameraObject, 
                 glm::vec3& targetPoint,
@@ -71,7 +35,7 @@ namespace lot {
             void selectObject(size_t index, const std::vector<LotGameObject>& objects);
             void selectNextObject(const std::vector<LotGameObject>& objects);
             void selectPrevObject(const std::vector<LotGameObject>& objects);
-            void rotateObjectsTest(GLFWwindow* window, float dt, LotGameObject& gameObject);
+            void rotateObjectsTest(LotInput& input, float dt, LotGameObject& gameObject);
 
             // 현재 선택된 객체 정보
             size_t getSelectedObjectIndex() const { return selectedObjectIndex; }
@@ -79,19 +43,14 @@ namespace lot {
             LotGameObject* getSelectedObject(std::vector<LotGameObject>& objects);
 
             // 스크롤 관련 함수
-            void processScrollInput(GLFWwindow* window, ProjectionType projType, 
+            void processScrollInput(LotInput& input, ProjectionType projType, 
                            float& orthoSize, LotGameObject& cameraObject, 
                            glm::vec3& targetPoint, float fov = glm::radians(50.0f));
-            static void scrollCallback(GLFWwindow* window, double xoffset, double yoffset);
-            static void mouseCallback(GLFWwindow* window, double xpos, double ypos);
-            void setScrollDelta(double delta) { scrollDelta = delta; }
             void setMouseDelta(double deltaX, double deltaY) {
                 mouseDeltaX = deltaX;
                 mouseDeltaY = deltaY;
             }
-            static void setInstance(KeyboardMoveCtrl* inst);
 
-            KeyMappings keys{};
             float moveSpeed{3.f};
             float lookSpeed{1.5f};
             float objectRotationSpeed{2.0f};    // 객체 회전 속도
@@ -109,19 +68,13 @@ namespace lot {
             float maxOrthoSize{10.0f};
         private:
             // 내부 헬퍼 함수들
-            void handleKeyboardObjectControl(GLFWwindow* window, float dt, std::vector<LotGameObject>& gameObject);
-            void processMouseInput(GLFWwindow* window);
+            bool handleKeyboardObjectControl(LotInput& input, float dt, std::vector<LotGameObject>& gameObject);
+            void processMouseInput(LotInput& input);
 
             // 객체 선택 관련 건
             size_t selectedObjectIndex{0};
             bool hasValidObjectSelection{false};
 
-            // 키 반복 입력 방지
-            bool wasSelectNextPressed{false};
-            bool wasSelectPrevPressed{false};
-            bool wasIncreaseSpeedPressed{false};
-            bool wasDecreaseSpeedPressed{false};
-
             // 마우스 상태 관리
             bool rightMousePressed{false};
             bool middleMousePressed{false};
@@ -138,17 +91,10 @@ namespace lot {
             glm::quat orbitRotation{1.0f, 0.0f, 0.0f, 0.0f};  // 누적 회전 쿼터니언
 
             // 마우스 상태 추적
-            bool wasRightPressed{false};
-            bool wasMiddlePressed{false};
             int rightClickFrameCounter{0};  // 우클릭 후 프레임 카운터
 
-            // 스크롤
-            double scrollDelta{0.0};
-
             // 마우스 델타 (콜백용)
             double mouseDeltaX{0.0};
             double mouseDeltaY{0.0};
-
-            static KeyboardMoveCtrl* instance;
     };
 } // namespace lot
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "lot_benchmark.h"
+#include "lot_job_system.h"
+
+// libs
+#include <glm/gtc/constants.hpp>
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#ifndef _WIN32
+    #include <sys/resource.h>
+#endif
+
+namespace lot {
+    // 회전 갱신을 잡 하나에 묶는 최소 객체 수
+    static constexpr size_t ANIMATE_GRAIN_SIZE = 1024;
+    // 카메라 높이가 오르내리는 폭
+    static constexpr float CAMERA_HEIGHT_AMPLITUDE = 1.5f;
+
+    namespace {
+        // 객체 인덱스와 시드로 만드는 재현 가능한 난수 (매 프레임 호출되므로 엔진을 만들지 않음)
+        uint32_t hash(uint32_t value) {
+            value ^= value >> 16;
+            value *= 0x7feb352dU;
+            value ^= value >> 15;
+            value *= 0x846ca68bU;
+            value ^= value >> 16;
+            return value;
+        }
+
+        float unitFloat(uint32_t value) {
+            return static_cast<float>(hash(value) & 0xFFFFFFu) / static_cast<float>(0x1000000);
+        }
+    }
+
+    LotFrameTimeStats LotFrameTimeStats::compute(const std::vector<double> &frameTimesMs) {
+        LotFrameTimeStats stats{};
+        if (frameTimesMs.empty()) {
+            return stats;
+        }
+        std::vector<double> sorted = frameTimesMs;
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&sorted](double p) {
+            size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+            return sorted[index];
+        };
+        stats.average = std::accumulate(sorted.begin(), sorted.end(), 0.0) / static_cast<double>(sorted.size());
+        stats.min = sorted.front();
+        stats.p50 = percentile(0.50);
+        stats.p95 = percentile(0.95);
+        stats.p99 = percentile(0.99);
+        stats.max = sorted.back();
+        return stats;
+    }
+
+    void LotBenchmark::generateScene(const LotBenchmarkConfig &config, std::shared_ptr<LotModel> model,
+                                     float modelScale, std::vector<LotGameObject> &objects) {
+        std::mt19937 random{config.seed};
+        std::uniform_real_distribution<float> unit{0.f, 1.f};
+        const glm::vec3 center{0.f, 0.f, SCENE_CENTER_Z};
+
+        // 격자 한 변의 개수와 칸 크기 (랜덤 배치도 같은 밀도 기준으로 크기를 정함)
+        uint32_t side = std::max(1u, static_cast<uint32_t>(std::ceil(std::cbrt(static_cast<double>(config.objectCount)))));
+        float spacing = 2.f * SCENE_HALF_EXTENT / static_cast<float>(side);
+        float baseScale = spacing * 0.6f * modelScale;
+
+        objects.reserve(objects.size() + config.objectCount);
+        for (uint32_t i = 0; i < config.objectCount; i++) {
+            auto object = LotGameObject::createGameObject();
+            object.model = model;
+
+            if (config.layout == LotBenchmarkConfig::Layout::Grid) {
+                uint32_t x = i % side;
+                uint32_t y = (i / side) % side;
+                uint32_t z = i / (side * side);
+                object.transform.translation = center + glm::vec3{
+                    (static_cast<float>(x) + 0.5f) * spacing - SCENE_HALF_EXTENT,
+                    (static_cast<float>(y) + 0.5f) * spacing - SCENE_HALF_EXTENT,
+                    (static_cast<float>(z) + 0.5f) * spacing - SCENE_HALF_EXTENT};
+                object.transform.scale = glm::vec3{baseScale};
+            } else {
+                object.transform.translation = center + glm::vec3{
+                    (unit(random) * 2.f - 1.f) * SCENE_HALF_EXTENT,
+                    (unit(random) * 2.f - 1.f) * SCENE_HALF_EXTENT,
+                    (unit(random) * 2.f - 1.f) * SCENE_HALF_EXTENT};
+                object.transform.scale = glm::vec3{baseScale * (0.5f + 0.5f * unit(random))};
+            }
+            object.color = {unit(random), unit(random), unit(random)};
+            objects.push_back(std::move(object));
+        }
+
+        // 정확히 비율만큼 선택되도록 섞은 순서의 앞부분을 선택
+        size_t selectedCount = static_cast<size_t>(
+            std::clamp(config.selectionFraction, 0.f, 1.f) * static_cast<float>(config.objectCount) + 0.5f);
+        std::vector<size_t> order(config.objectCount);
+        std::iota(order.begin(), order.end(), objects.size() - config.objectCount);
+        std::shuffle(order.begin(), order.end(), random);
+        for (size_t i = 0; i < selectedCount; i++) {
+            objects[order[i]].isSelected = true;
+        }
+    }
+
+    void LotBenchmark::animateScene(const LotBenchmarkConfig &config, float seconds,
+                                    std::vector<LotGameObject> &objects) {
+        LotJobSystem::instance().parallelFor(objects.size(), ANIMATE_GRAIN_SIZE, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                uint32_t key = config.seed * 0x9e3779b9U + static_cast<uint32_t>(i) * 4;
+                glm::vec3 axis{unitFloat(key) * 2.f - 1.f, unitFloat(key + 1) * 2.f - 1.f, unitFloat(key + 2) * 2.f - 1.f};
+                if (glm::dot(axis, axis) < 1e-4f) {
+                    axis = {0.f, 1.f, 0.f};
+                }
+                // 초당 0.25~1바퀴
+                float speed = glm::two_pi<float>() * (0.25f + 0.75f * unitFloat(key + 3));
+                objects[i].transform.rotation = glm::angleAxis(speed * seconds, glm::normalize(axis));
+            }
+        });
+    }
+
+    void LotBenchmark::cameraPose(float t, glm::vec3 &position, glm::vec3 &target) {
+        float angle = glm::two_pi<float>() * t;
+        target = {0.f, 0.f, SCENE_CENTER_Z};
+        position = target + glm::vec3{
+            CAMERA_ORBIT_RADIUS * std::sin(angle),
+            CAMERA_HEIGHT_AMPLITUDE * std::sin(2.f * angle),
+            -CAMERA_ORBIT_RADIUS * std::cos(angle)};
+    }
+
+    const char *LotBenchmark::shapeName(LotBenchmarkConfig::Shape shape) {
+        return shape == LotBenchmarkConfig::Shape::Vase ? "vase" : "cube";
+    }
+
+    const char *LotBenchmark::layoutName(LotBenchmarkConfig::Layout layout) {
+        return layout == LotBenchmarkConfig::Layout::Random ? "random" : "grid";
+    }
+
+    uint64_t LotBenchmark::peakResidentBytes() {
+    #ifdef _WIN32
+        return 0;
+    #else
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+        #ifdef __APPLE__
+            return static_cast<uint64_t>(usage.ru_maxrss);          // 바이트
+        #else
+            return static_cast<uint64_t>(usage.ru_maxrss) * 1024;   // KB
+        #endif
+    #endif
+    }
+
+    void LotBenchmark::writeReport(const LotBenchmarkConfig &config, const LotBenchmarkReport &report) {
+        std::ofstream file{config.reportPath, std::ios::trunc};
+        if (!file.is_open()) {
+            throw std::runtime_error("failed to open file: " + config.reportPath);
+        }
+
+        auto writeMap = [&file](const std::map<std::string, double> &values) {
+            file << "{";
+            bool first = true;
+            for (const auto &[name, value] : values) {
+                file << (first ? "" : ", ") << "\"" << name << "\": " << value;
+                first = false;
+            }
+            file << "}";
+        };
+
+        LotFrameTimeStats stats = LotFrameTimeStats::compute(report.frameTimesMs);
+        size_t frameCount = report.frameTimesMs.size();
+        file << "{\n"
+             << "  \"scene\": {\"objects\": " << config.objectCount
+             << ", \"shape\": \"" << shapeName(config.shape) << "\""
+             << ", \"layout\": \"" << layoutName(config.layout) << "\""
+             << ", \"rotating\": " << (config.rotating ? "true" : "false")
+             << ", \"selectionFraction\": " << config.selectionFraction
+             << ", \"selected\": " << report.selectedObjects
+             << ", \"triangles\": " << report.triangles
+             << ", \"seed\": " << config.seed << "},\n"
+             << "  \"device\": \"" << report.deviceName << "\",\n"
+             << "  \"presentMode\": \"" << report.presentMode << "\",\n"
+             << "  \"framesInFlight\": " << report.framesInFlight << ",\n"
+             << "  \"extent\": [" << report.width << ", " << report.height << "],\n"
+             << "  \"headless\": " << (report.headless ? "true" : "false") << ",\n"
+             << "  \"frames\": " << frameCount << ",\n"
+             << "  \"warmupFrames\": " << report.warmupFrames << ",\n"
+             << "  \"totalSeconds\": " << report.totalSeconds << ",\n"
+             << "  \"fps\": " << (report.totalSeconds > 0.0 ? static_cast<double>(frameCount) / report.totalSeconds : 0.0)
+             << ",\n"
+             << "  \"frameTimeMs\": {\"avg\": " << stats.average << ", \"min\": " << stats.min
+             << ", \"p50\": " << stats.p50 << ", \"p95\": " << stats.p95 << ", \"p99\": " << stats.p99
+             << ", \"max\": " << stats.max << "},\n"
+             << "  \"cpuMs\": ";
+        writeMap(report.cpuMs);
+        file << ",\n  \"gpuMs\": ";
+        writeMap(report.gpuMs);
+        file << ",\n  \"memory\": {\"gpuBytes\": " << static_cast<uint64_t>(report.gpuMemoryBytes)
+             << ", \"allocationsPerFrame\": " << report.allocationsPerFrame
+             << ", \"peakResidentBytes\": " << report.peakResidentBytes << "}\n"
+             << "}\n";
+
+        std::cout << "[Benchmark] " << config.objectCount << " " << shapeName(config.shape) << "s, "
+                  << frameCount << " frames - p50: " << stats.p50 << " ms, p95: " << stats.p95
+                  << " ms, p99: " << stats.p99 << " ms -> " << config.reportPath << std::endl;
+    }
+} // namespace lot
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "lot_game_object.h"
+
+// libs
+#include <glm/glm.hpp>
+
+// std
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace lot {
+    struct LotBenchmarkConfig {
+        enum class Shape { Cube, Vase };
+        enum class Layout { Grid, Random };
+
+        uint32_t objectCount{1000};
+        Shape shape{Shape::Cube};
+        Layout layout{Layout::Grid};
+        // 매 프레임 모든 객체를 회전 (트랜스폼 갱신/업로드 비용 포함)
+        bool rotating{false};
+        // 선택(하이라이트 패스) 상태로 만들 객체 비율 (0~1)
+        float selectionFraction{0.f};
+        uint32_t seed{1};
+        std::string reportPath{"benchmark_report.json"};
+    };
+
+    // 측정 구간 프레임 시간 통계 (ms)
+    struct LotFrameTimeStats {
+        double average = 0.0;
+        double min = 0.0;
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+
+        static LotFrameTimeStats compute(const std::vector<double> &frameTimesMs);
+    };
+
+    struct LotBenchmarkReport {
+        std::string deviceName;
+        // 요청한 프레젠트 모드와 동시 진행 프레임 수 (헤드리스는 프레젠트 모드 무관)
+        std::string presentMode;
+        uint32_t framesInFlight = 0;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        bool headless = false;
+
+        size_t selectedObjects = 0;
+        uint64_t triangles = 0;
+
+        uint32_t warmupFrames = 0;
+        std::vector<double> frameTimesMs;
+        double totalSeconds = 0.0;
+
+        // 이름별 프레임당 평균 ms (CPU는 메인 갱신 + 렌더 단계별, GPU는 프로파일러 구간별)
+        std::map<std::string, double> cpuMs;
+        std::map<std::string, double> gpuMs;
+
+        double gpuMemoryBytes = 0.0;
+        double allocationsPerFrame = 0.0;
+        // 0이면 측정하지 못함
+        uint64_t peakResidentBytes = 0;
+    };
+
+    // 벤치마크 장면 생성, 카메라 경로, JSON 보고서
+    // - 같은 설정/시드면 같은 장면과 경로를 만들어 빌드 간 결과를 비교할 수 있음
+    // - 장면은 카메라 경로가 원근 투영의 far(10) 안에 들어오도록 (0, 0, SCENE_CENTER_Z) 주변 상자 안에 배치
+    class LotBenchmark {
+        public:
+            static constexpr float SCENE_CENTER_Z = 4.0f;
+            static constexpr float SCENE_HALF_EXTENT = 2.0f;
+            static constexpr float CAMERA_ORBIT_RADIUS = 5.0f;
+
+            // model의 크기가 1 단위일 때의 배율이 modelScale (큐브 1, 꽃병 3)
+            static void generateScene(const LotBenchmarkConfig &config, std::shared_ptr<LotModel> model,
+                                      float modelScale, std::vector<LotGameObject> &objects);
+            // 회전 장면: 객체마다 시드로 정한 축/속도로 seconds 시점의 회전을 설정
+            static void animateScene(const LotBenchmarkConfig &config, float seconds,
+                                     std::vector<LotGameObject> &objects);
+            // t(0~1)를 따라 장면 중심을 한 바퀴 돌며 높이가 오르내리는 카메라 경로
+            static void cameraPose(float t, glm::vec3 &position, glm::vec3 &target);
+
+            static const char *shapeName(LotBenchmarkConfig::Shape shape);
+            static const char *layoutName(LotBenchmarkConfig::Layout layout);
+            static uint64_t peakResidentBytes();
+
+            static void writeReport(const LotBenchmarkConfig &config, const LotBenchmarkReport &report);
+    };
+} // namespace lot
@@ -0,0 +1,99 @@
+#include "lot_buffer.h"
+
+// std
+#include <cassert>
+#include <cstring>
+
+namespace lot {
+    // minOffsetAlignment(예: minUniformBufferOffsetAlignment)의 배수로 인스턴스 크기를 올림
+    VkDeviceSize LotBuffer::getAlignment(VkDeviceSize instanceSize, VkDeviceSize minOffsetAlignment) {
+        if (minOffsetAlignment > 0) {
+            return (instanceSize + minOffsetAlignment - 1) & ~(minOffsetAlignment - 1);
+        }
+        return instanceSize;
+    }
+
+    LotBuffer::LotBuffer(
+        LotDevice &device,
+        VkDeviceSize instanceSize,
+        uint32_t instanceCount,
+        VkBufferUsageFlags usageFlags,
+        VkMemoryPropertyFlags memoryPropertyFlags,
+        VkDeviceSize minOffsetAlignment)
+    : lotDevice{device},
+      instanceCount{instanceCount},
+      instanceSize{instanceSize},
+      usageFlags{usageFlags},
+      memoryPropertyFlags{memoryPropertyFlags} {
+        alignmentSize = getAlignment(instanceSize, minOffsetAlignment);
+        bufferSize = alignmentSize * instanceCount;
+        device.createBuffer(bufferSize, usageFlags, memoryPropertyFlags, buffer, memory);
+    }
+
+    LotBuffer::~LotBuffer() {
+        unmap();
+        lotDevice.deletionQueue().destroyBuffer(buffer, memory);
+    }
+
+    VkResult LotBuffer::map(VkDeviceSize size, VkDeviceSize offset) {
+        assert(buffer && memory && "Called map on buffer before create");
+        return vkMapMemory(lotDevice.device(), memory, offset, size, 0, &mapped);
+    }
+
+    void LotBuffer::unmap() {
+        if (mapped) {
+            vkUnmapMemory(lotDevice.device(), memory);
+            mapped = nullptr;
+        }
+    }
+
+    void LotBuffer::writeToBuffer(const void *data, VkDeviceSize size, VkDeviceSize offset) {
+        assert(mapped && "Cannot copy to unmapped buffer");
+
+        if (size == VK_WHOLE_SIZE) {
+            memcpy(mapped, data, bufferSize);
+        } else {
+            char *memOffset = static_cast<char *>(mapped);
+            memOffset += offset;
+            memcpy(memOffset, data, size);
+        }
+    }
+
+    // HOST_COHERENT가 아닌 메모리에서 CPU 쓰기를 GPU에 보이게 함
+    VkResult LotBuffer::flush(VkDeviceSize size, VkDeviceSize offset) {
+        VkMappedMemoryRange mappedRange = {};
+        mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        mappedRange.memory = memory;
+        mappedRange.offset = offset;
+        mappedRange.size = size;
+        return vkFlushMappedMemoryRanges(lotDevice.device(), 1, &mappedRange);
+    }
+
+    // HOST_COHERENT가 아닌 메모리에서 GPU 쓰기를 CPU에 보이게 함
+    VkResult LotBuffer::invalidate(VkDeviceSize size, VkDeviceSize offset) {
+        VkMappedMemoryRange mappedRange = {};
+        mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        mappedRange.memory = memory;
+        mappedRange.offset = offset;
+        mappedRange.size = size;
+        return vkInvalidateMappedMemoryRanges(lotDevice.device(), 1, &mappedRange);
+    }
+
+    VkDescriptorBufferInfo LotBuffer::descriptorInfo(VkDeviceSize size, VkDeviceSize offset) {
+        return VkDescriptorBufferInfo{buffer, offset, size};
+    }
+
+    void LotBuffer::writeToIndex(const void *data, int index) {
+        writeToBuffer(data, instanceSize, index * alignmentSize);
+    }
+
+    VkResult LotBuffer::flushIndex(int index) { return flush(alignmentSize, index * alignmentSize); }
+
+    VkDescriptorBufferInfo LotBuffer::descriptorInfoForIndex(int index) {
+        return descriptorInfo(alignmentSize, index * alignmentSize);
+    }
+
+    VkResult LotBuffer::invalidateIndex(int index) {
+        return invalidate(alignmentSize, index * alignmentSize);
+    }
+} // namespace lot
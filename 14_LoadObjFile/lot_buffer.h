@@ -0,0 +1,58 @@
+#pragma once
+
+#include "lot_device.h"
+
+namespace lot {
+    // VkBuffer + VkDeviceMemory 래퍼 (인스턴스 단위 정렬/매핑/플러시 지원)
+    class LotBuffer {
+        public:
+            LotBuffer(
+                LotDevice &device,
+                VkDeviceSize instanceSize,
+                uint32_t instanceCount,
+                VkBufferUsageFlags usageFlags,
+                VkMemoryPropertyFlags memoryPropertyFlags,
+                VkDeviceSize minOffsetAlignment = 1);
+            ~LotBuffer();
+
+            LotBuffer(const LotBuffer &) = delete;
+            LotBuffer &operator=(const LotBuffer &) = delete;
+
+            VkResult map(VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
+            void unmap();
+
+            void writeToBuffer(const void *data, VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
+            VkResult flush(VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
+            VkDescriptorBufferInfo descriptorInfo(VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
+            VkResult invalidate(VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
+
+            void writeToIndex(const void *data, int index);
+            VkResult flushIndex(int index);
+            VkDescriptorBufferInfo descriptorInfoForIndex(int index);
+            VkResult invalidateIndex(int index);
+
+            VkBuffer getBuffer() const { return buffer; }
+            void *getMappedMemory() const { return mapped; }
+            uint32_t getInstanceCount() const { return instanceCount; }
+            VkDeviceSize getInstanceSize() const { return instanceSize; }
+            VkDeviceSize getAlignmentSize() const { return alignmentSize; }
+            VkBufferUsageFlags getUsageFlags() const { return usageFlags; }
+            VkMemoryPropertyFlags getMemoryPropertyFlags() const { return memoryPropertyFlags; }
+            VkDeviceSize getBufferSize() const { return bufferSize; }
+
+        private:
+            static VkDeviceSize getAlignment(VkDeviceSize instanceSize, VkDeviceSize minOffsetAlignment);
+
+            LotDevice &lotDevice;
+            void *mapped = nullptr;
+            VkBuffer buffer = VK_NULL_HANDLE;
+            VkDeviceMemory memory = VK_NULL_HANDLE;
+
+            VkDeviceSize bufferSize;
+            uint32_t instanceCount;
+            VkDeviceSize instanceSize;
+            VkDeviceSize alignmentSize;
+            VkBufferUsageFlags usageFlags;
+            VkMemoryPropertyFlags memoryPropertyFlags;
+    };
+} // namespace lot
@@ -0,0 +1,127 @@
+#include "lot_cpu_profiler.h"
+
+// std
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+namespace lot {
+    namespace {
+        constexpr uint64_t EVENT_INDEX_MASK = LotCpuProfiler::EVENTS_PER_THREAD - 1;
+
+        thread_local void *threadBufferBinding = nullptr;
+
+        void writeJsonString(std::ostream &out, const std::string &value) {
+            out << '"';
+            for (char c : value) {
+                if (c == '"' || c == '\\') {
+                    out << '\\' << c;
+                } else if (static_cast<unsigned char>(c) >= 0x20) {
+                    out << c;
+                }
+            }
+            out << '"';
+        }
+    }
+
+    LotCpuProfiler::LotCpuProfiler() : epochNs{now()} {
+        if (const char *path = std::getenv("LOT_CPU_TRACE")) {
+            tracePath = path;
+            enabled = true;
+        }
+    }
+
+    LotCpuProfiler &LotCpuProfiler::instance() {
+        static LotCpuProfiler profiler;
+        return profiler;
+    }
+
+    LotCpuProfiler::ThreadBuffer &LotCpuProfiler::currentThreadBuffer() {
+        // 버퍼는 프로파일러가 소유하므로 스레드가 끝나도 이벤트는 내보낼 때까지 남음
+        if (threadBufferBinding != nullptr) {
+            return *static_cast<ThreadBuffer *>(threadBufferBinding);
+        }
+
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->events = std::make_unique<EventSlot[]>(EVENTS_PER_THREAD);
+
+        std::lock_guard<std::mutex> lock{registryMutex};
+        buffer->threadId = static_cast<uint32_t>(threadBuffers.size()) + 1;
+        buffer->name = "Thread " + std::to_string(buffer->threadId);
+        threadBufferBinding = buffer.get();
+        threadBuffers.push_back(std::move(buffer));
+        return *threadBuffers.back();
+    }
+
+    void LotCpuProfiler::setThreadName(const char *name) {
+        ThreadBuffer &buffer = currentThreadBuffer();
+        std::lock_guard<std::mutex> lock{registryMutex};
+        buffer.name = name;
+    }
+
+    void LotCpuProfiler::record(const char *name, uint64_t startNs, uint64_t endNs) {
+        ThreadBuffer &buffer = currentThreadBuffer();
+        uint64_t index = buffer.head.load(std::memory_order_relaxed);
+        EventSlot &slot = buffer.events[index & EVENT_INDEX_MASK];
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.startNs.store(startNs, std::memory_order_relaxed);
+        slot.endNs.store(endNs, std::memory_order_relaxed);
+        buffer.head.store(index + 1, std::memory_order_release);
+    }
+
+    void LotCpuProfiler::writeChromeTrace(const std::string &filepath) {
+        std::ofstream file{filepath, std::ios::trunc};
+        if (!file.is_open()) {
+            throw std::runtime_error("failed to open file: " + filepath);
+        }
+
+        std::lock_guard<std::mutex> lock{registryMutex};
+        file << std::fixed << std::setprecision(3);
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        size_t eventCount = 0;
+        for (const auto &buffer : threadBuffers) {
+            file << (first ? "\n" : ",\n") << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":"
+                 << buffer->threadId << ",\"args\":{\"name\":";
+            writeJsonString(file, buffer->name);
+            file << "}}";
+            first = false;
+
+            uint64_t head = buffer->head.load(std::memory_order_acquire);
+            uint64_t begin = head > EVENTS_PER_THREAD ? head - EVENTS_PER_THREAD : 0;
+            for (uint64_t i = begin; i < head; i++) {
+                const EventSlot &slot = buffer->events[i & EVENT_INDEX_MASK];
+                const char *name = slot.name.load(std::memory_order_relaxed);
+                uint64_t startNs = slot.startNs.load(std::memory_order_relaxed);
+                uint64_t endNs = slot.endNs.load(std::memory_order_relaxed);
+
+                // 읽는 동안 소유 스레드가 이 슬롯을 덮어썼을 수 있으면 버림
+                uint64_t currentHead = buffer->head.load(std::memory_order_acquire);
+                if (i + EVENTS_PER_THREAD <= currentHead) {
+                    continue;
+                }
+                if (name == nullptr || endNs < startNs || startNs < epochNs) {
+                    continue;
+                }
+
+                file << ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"name\":";
+                writeJsonString(file, name);
+                file << ",\"ts\":" << static_cast<double>(startNs - epochNs) / 1000.0
+                     << ",\"dur\":" << static_cast<double>(endNs - startNs) / 1000.0 << "}";
+                eventCount++;
+            }
+        }
+        file << "\n]}\n";
+
+        std::cout << "[CpuProfiler] Wrote " << eventCount << " events from " << threadBuffers.size()
+                  << " threads to " << filepath << std::endl;
+    }
+
+    void LotCpuProfiler::writeTraceIfRequested() {
+        if (!tracePath.empty()) {
+            writeChromeTrace(tracePath);
+        }
+    }
+} // namespace lot
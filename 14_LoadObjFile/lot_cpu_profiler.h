@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lot {
+    // 구간(scope) 단위 CPU 프로파일러
+    // - 스레드마다 고정 크기 링 버퍼를 두고 소유 스레드만 쓰므로 기록 경로에 잠금이 없음 (오래된 이벤트는 덮어씀)
+    // - LOT_ENABLE_CPU_PROFILER가 정의되지 않으면 LOT_PROFILE_* 매크로는 아무 코드도 만들지 않음
+    // - writeChromeTrace()는 chrome://tracing / Perfetto에서 열 수 있는 JSON을 저장
+    class LotCpuProfiler {
+        public:
+            static constexpr uint64_t EVENTS_PER_THREAD = 1 << 16;   // 2의 거듭제곱
+
+            // 기본값: LOT_CPU_TRACE 환경 변수가 있으면 기록을 켜고 종료 시 그 경로에 저장
+            static LotCpuProfiler &instance();
+
+            // steady_clock은 x86 Linux(vDSO)/Windows(QPC)에서 TSC 기반이라 호출 비용이 수십 ns 수준
+            static uint64_t now() {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+
+            void setEnabled(bool value) { enabled.store(value, std::memory_order_relaxed); }
+            bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+            // 호출 스레드의 트레이스 표시 이름
+            void setThreadName(const char *name);
+            // 호출 스레드의 링 버퍼에 완료된 구간 하나를 기록 (name은 정적 문자열)
+            void record(const char *name, uint64_t startNs, uint64_t endNs);
+
+            // 모든 스레드의 링 버퍼에 남아 있는 이벤트를 Chrome trace 형식으로 저장
+            void writeChromeTrace(const std::string &filepath);
+            // LOT_CPU_TRACE가 지정되어 있으면 그 경로에 저장
+            void writeTraceIfRequested();
+
+        private:
+            LotCpuProfiler();
+
+            // 여러 스레드가 같은 슬롯을 동시에 읽고 쓸 수 있으므로 필드는 relaxed 원자 변수
+            struct EventSlot {
+                std::atomic<const char *> name{nullptr};
+                std::atomic<uint64_t> startNs{0};
+                std::atomic<uint64_t> endNs{0};
+            };
+
+            struct ThreadBuffer {
+                uint32_t threadId = 0;
+                std::string name;
+                std::unique_ptr<EventSlot[]> events;
+                // 지금까지 기록한 이벤트 수 (소유 스레드만 증가)
+                std::atomic<uint64_t> head{0};
+            };
+
+            ThreadBuffer &currentThreadBuffer();
+
+            std::atomic<bool> enabled{false};
+            uint64_t epochNs;
+            std::string tracePath;
+
+            // 스레드 등록/이름 변경/내보내기에서만 잡음 (기록 경로는 잠그지 않음)
+            std::mutex registryMutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+    };
+
+    // 생성~소멸 구간을 기록하는 RAII 도우미 (LOT_PROFILE_SCOPE로 사용)
+    class LotProfileScope {
+        public:
+            explicit LotProfileScope(const char *name)
+            : name{name}, startNs{LotCpuProfiler::instance().isEnabled() ? LotCpuProfiler::now() : 0} {}
+
+            ~LotProfileScope() {
+                if (startNs != 0) {
+                    LotCpuProfiler::instance().record(name, startNs, LotCpuProfiler::now());
+                }
+            }
+
+            LotProfileScope(const LotProfileScope &) = delete;
+            LotProfileScope &operator=(const LotProfileScope &) = delete;
+
+        private:
+            const char *name;
+            uint64_t startNs;
+    };
+} // namespace lot
+
+#ifdef LOT_ENABLE_CPU_PROFILER
+    #define LOT_PROFILE_CONCAT_INNER(a, b) a##b
+    #define LOT_PROFILE_CONCAT(a, b) LOT_PROFILE_CONCAT_INNER(a, b)
+    #define LOT_PROFILE_SCOPE(name) ::lot::LotProfileScope LOT_PROFILE_CONCAT(lotProfileScope, __COUNTER__){name}
+    #define LOT_PROFILE_THREAD(name) ::lot::LotCpuProfiler::instance().setThreadName(name)
+#else
+    #define LOT_PROFILE_SCOPE(name) ((void)0)
+    #define LOT_PROFILE_THREAD(name) ((void)0)
+#endif
@@ -0,0 +1,108 @@
+#include "lot_deletion_queue.h"
+#include "lot_cpu_profiler.h"
+#include "lot_device.h"
+#include "lot_metrics.h"
+
+// std
+#include <algorithm>
+
+namespace lot {
+    namespace {
+        LotGauge &pendingDeletionsGauge() {
+            static LotGauge &gauge = LotMetrics::instance().gauge("pending_deletions");
+            return gauge;
+        }
+    }
+
+    LotDeletionQueue::LotDeletionQueue(LotDevice &device) : lotDevice{device} {}
+
+    LotDeletionQueue::~LotDeletionQueue() {
+        flush();
+    }
+
+    void LotDeletionQueue::destroyBuffer(VkBuffer buffer, VkDeviceMemory memory) {
+        PendingDeletion deletion;
+        deletion.buffer = buffer;
+        deletion.memory = memory;
+        enqueue(deletion);
+    }
+
+    void LotDeletionQueue::destroyPipeline(VkPipeline pipeline) {
+        PendingDeletion deletion;
+        deletion.pipeline = pipeline;
+        enqueue(deletion);
+    }
+
+    void LotDeletionQueue::freeMemory(VkDeviceMemory memory) {
+        PendingDeletion deletion;
+        deletion.memory = memory;
+        enqueue(deletion);
+    }
+
+    void LotDeletionQueue::enqueue(PendingDeletion deletion) {
+        if (deletion.buffer == VK_NULL_HANDLE && deletion.pipeline == VK_NULL_HANDLE &&
+            deletion.memory == VK_NULL_HANDLE) {
+            return;
+        }
+        size_t count;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            deletion.frame = startedFrames.load(std::memory_order_acquire);
+            pending.push_back(deletion);
+            count = pending.size();
+        }
+        pendingDeletionsGauge().set(static_cast<double>(count));
+    }
+
+    void LotDeletionQueue::collect(uint64_t completedFrames) {
+        size_t remaining;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (pending.empty() || pending.front().frame > completedFrames) {
+                return;
+            }
+            auto end = std::find_if(pending.begin(), pending.end(),
+                [completedFrames](const PendingDeletion &deletion) { return deletion.frame > completedFrames; });
+            ready.assign(pending.begin(), end);
+            pending.erase(pending.begin(), end);
+            remaining = pending.size();
+        }
+
+        // 수천 개를 지워도 다른 스레드의 enqueue를 막지 않도록 잠금 밖에서 해제
+        LOT_PROFILE_SCOPE("LotDeletionQueue::collect");
+        for (const auto &deletion : ready) {
+            destroy(deletion);
+        }
+        ready.clear();
+        pendingDeletionsGauge().set(static_cast<double>(remaining));
+    }
+
+    void LotDeletionQueue::flush() {
+        std::vector<PendingDeletion> all;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            all.swap(pending);
+        }
+        for (const auto &deletion : all) {
+            destroy(deletion);
+        }
+        pendingDeletionsGauge().set(0.0);
+    }
+
+    size_t LotDeletionQueue::pendingCount() const {
+        std::lock_guard<std::mutex> lock{mutex};
+        return pending.size();
+    }
+
+    void LotDeletionQueue::destroy(const PendingDeletion &deletion) {
+        VkDevice device = lotDevice.device();
+        if (deletion.pipeline != VK_NULL_HANDLE) {
+            vkDestroyPipeline(device, deletion.pipeline, nullptr);
+        }
+        if (deletion.buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device, deletion.buffer, nullptr);
+        }
+        // 메모리는 바인딩된 자원을 파괴한 뒤 해제
+        lotDevice.freeMemory(deletion.memory);
+    }
+} // namespace lot
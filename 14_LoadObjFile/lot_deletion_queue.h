@@ -0,0 +1,63 @@
+#pragma once
+
+// Vulkan header
+#include "vulkan/vulkan.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace lot {
+    class LotDevice;
+
+    // GPU가 아직 읽고 있을 수 있는 자원의 지연 파괴 큐 (LotDevice 소유)
+    // - 어느 스레드에서든 destroy*/freeMemory로 넣으면 그때까지 기록을 시작한 프레임 수로 태그
+    // - 렌더러가 프레임 슬롯 펜스를 기다린 뒤 collect(완료된 프레임 수)를 호출하면 태그 이하 항목을 한꺼번에 해제
+    //   (그 자원을 참조할 수 있는 프레임은 태그 이전에 시작한 프레임뿐이므로)
+    // 호출 스레드는 vkDestroy*를 기다리지 않고, GPU 파이프라인도 비우지 않음
+    class LotDeletionQueue {
+        public:
+            explicit LotDeletionQueue(LotDevice &device);
+            ~LotDeletionQueue();
+
+            LotDeletionQueue(const LotDeletionQueue &) = delete;
+            LotDeletionQueue &operator=(const LotDeletionQueue &) = delete;
+
+            // VK_NULL_HANDLE 인자는 무시
+            void destroyBuffer(VkBuffer buffer, VkDeviceMemory memory);
+            void destroyPipeline(VkPipeline pipeline);
+            void freeMemory(VkDeviceMemory memory);
+
+            // 렌더러 전용: 프레임 기록을 시작할 때 (이후에 넣은 항목은 이 프레임이 끝나야 해제)
+            void beginFrame() { startedFrames.fetch_add(1, std::memory_order_release); }
+            // 렌더러 전용: 처음 completedFrames개 프레임의 펜스가 신호된 뒤 호출
+            // (beginFrame과 온디맨드 유휴 대기 전에 호출되므로 프레임이 멈춰도 해제가 미뤄지지 않음)
+            void collect(uint64_t completedFrames);
+            // 디바이스가 유휴 상태일 때만 호출 (종료 시 남은 항목을 모두 해제)
+            void flush();
+
+            size_t pendingCount() const;
+
+        private:
+            struct PendingDeletion {
+                // 넣을 때까지 시작된 프레임 수
+                uint64_t frame = 0;
+                VkBuffer buffer = VK_NULL_HANDLE;
+                VkPipeline pipeline = VK_NULL_HANDLE;
+                VkDeviceMemory memory = VK_NULL_HANDLE;
+            };
+
+            void enqueue(PendingDeletion deletion);
+            void destroy(const PendingDeletion &deletion);
+
+            LotDevice &lotDevice;
+            std::atomic<uint64_t> startedFrames{0};
+
+            mutable std::mutex mutex;
+            // frame 오름차순 (넣을 때 잠금 안에서 태그하므로)
+            std::vector<PendingDeletion> pending;
+            // collect가 잠금 밖에서 해제할 항목 (용량 재사용, 렌더러 스레드 전용)
+            std::vector<PendingDeletion> ready;
+    };
+} // namespace lot
@@ -1,4 +1,7 @@
 #include "lot_device.h"
+#include "lot_cpu_profiler.h"
+#include "lot_flight_recorder.h"
+#include "lot_metrics.h"
 
 // std headers
 #include <cstring>
@@ -7,6 +10,18 @@
 #include <unordered_set>
 
 namespace lot {
+    namespace {
+        LotGauge &gpuMemoryBytes() {
+            static LotGauge &gauge = LotMetrics::instance().gauge("gpu_memory_bytes");
+            return gauge;
+        }
+
+        LotCounter &uploadBytes() {
+            static LotCounter &counter = LotMetrics::instance().counter("upload_bytes");
+            return counter;
+        }
+    }
+
     // local callback functions
     static VKAPI_ATTR VkBool32 VKAPI_CALL debugCallback(
         VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
@@ -43,16 +58,25 @@ namespace lot {
         }
     }
 
-    LotDevice::LotDevice(LotWindow &window) : window{window} {
+    LotDevice::LotDevice(LotWindow *window) : window{window} {
         createInstance();
         setupDebugMessenger();
         createSurface();
         pickPhysicalDevice();
         createLogicalDevice();
         createCommandPool();
+        createPipelineCache();
+        deletionQueue_ = std::make_unique<LotDeletionQueue>(*this);
     }
 
     LotDevice::~LotDevice() {
+        // 소유자가 유휴 대기를 마친 뒤이므로 남은 지연 파괴 항목을 모두 해제
+        deletionQueue_.reset();
+        // 이 시점에는 모든 파이프라인이 생성을 마쳤으므로 누적된 캐시를 디스크에 저장
+        pipelineCache_->save();
+        pipelineCache_.reset();
+        shaderLibrary_.reset();
+
         vkDestroyCommandPool(device_, commandPool, nullptr);
         vkDestroyDevice(device_, nullptr);
 
@@ -60,7 +84,9 @@ namespace lot {
             DestroyDebugUtilsMessengerEXT(instance, debugMessenger, nullptr);
         }
 
-        vkDestroySurfaceKHR(instance, surface_, nullptr);
+        if (surface_ != VK_NULL_HANDLE) {
+            vkDestroySurfaceKHR(instance, surface_, nullptr);
+        }
         vkDestroyInstance(instance, nullptr);
     }
 
@@ -146,7 +172,10 @@ namespace lot {
     }
 
     void LotDevice::createSurface() {
-        window.createWindowSurface(instance, &surface_);
+        if (isHeadless()) {
+            return;
+        }
+        window->createWindowSurface(instance, &surface_);
     }
 
     void LotDevice::pickPhysicalDevice() {
@@ -191,12 +220,19 @@ namespace lot {
             queueCreateInfos.push_back(queueCreateInfo);
         }
 
+        VkPhysicalDeviceFeatures supportedFeatures;
+        vkGetPhysicalDeviceFeatures(physicalDevice, &supportedFeatures);
+
         VkPhysicalDeviceFeatures deviceFeatures = {};
         deviceFeatures.samplerAnisotropy = VK_TRUE;
         #ifndef __APPLE__
         deviceFeatures.fillModeNonSolid = VK_TRUE;
         deviceFeatures.wideLines = VK_TRUE;
         #endif
+        // 프로파일러의 통계 쿼리는 보조 커맨드 버퍼를 감싸므로 쿼리 상속까지 지원될 때만 켬
+        pipelineStatisticsEnabled_ = supportedFeatures.pipelineStatisticsQuery && supportedFeatures.inheritedQueries;
+        deviceFeatures.pipelineStatisticsQuery = pipelineStatisticsEnabled_ ? VK_TRUE : VK_FALSE;
+        deviceFeatures.inheritedQueries = pipelineStatisticsEnabled_ ? VK_TRUE : VK_FALSE;
 
         VkDeviceCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -205,6 +241,7 @@ namespace lot {
         createInfo.pQueueCreateInfos = queueCreateInfos.data();
 
         createInfo.pEnabledFeatures = &deviceFeatures;
+        auto deviceExtensions = getDeviceExtensions();
         createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
         createInfo.ppEnabledExtensionNames = deviceExtensions.data();
 
@@ -219,22 +256,40 @@ namespace lot {
             throw std::runtime_error("failed to create logical device!");
         }
 
+        uint32_t queueFamilyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+        timestampValidBits_ = queueFamilies[indices.graphicsFamily].timestampValidBits;
+
         vkGetDeviceQueue(device_, indices.graphicsFamily, 0, &graphicsQueue_);
         vkGetDeviceQueue(device_, indices.presentFamily, 0, &presentQueue_);
     }
     
     void LotDevice::createCommandPool() {
+        commandPool = createGraphicsCommandPool(
+            VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    }
+
+    void LotDevice::createPipelineCache() {
+        pipelineCache_ = std::make_unique<LotPipelineCache>(
+            device_, properties, LotPipelineCache::defaultFilepath());
+        shaderLibrary_ = std::make_unique<LotShaderLibrary>(device_);
+    }
+
+    VkCommandPool LotDevice::createGraphicsCommandPool(VkCommandPoolCreateFlags flags) {
         QueueFamilyIndices queueFamilyIndices = findPhysicalQueueFamilies();
 
         VkCommandPoolCreateInfo poolInfo = {};
         poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
         poolInfo.queueFamilyIndex = queueFamilyIndices.graphicsFamily;
-        poolInfo.flags = 
-            VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        
-        if (vkCreateCommandPool(device_, &poolInfo, nullptr, &commandPool) != VK_SUCCESS ) {
+        poolInfo.flags = flags;
+
+        VkCommandPool pool;
+        if (vkCreateCommandPool(device_, &poolInfo, nullptr, &pool) != VK_SUCCESS ) {
             throw std::runtime_error("failed to create command pool!");
         }
+        return pool;
     }
 
     bool LotDevice::isDeviceSuitable(VkPhysicalDevice device) {
@@ -242,8 +297,9 @@ namespace lot {
 
         bool extensionsSupported = checkDeviceExtensionSupport(device);
 
-        bool swapChainAdequate = false;
-        if (extensionsSupported) {
+        // 헤드리스에서는 프레젠트하지 않으므로 스왑체인 지원 여부를 보지 않음
+        bool swapChainAdequate = isHeadless();
+        if (extensionsSupported && !isHeadless()) {
             SwapChainSupportDetails swapChainSupport = querySwapChainSupport(device);
             swapChainAdequate = !swapChainSupport.formats.empty() && !swapChainSupport.presentModes.empty();
         }
@@ -256,11 +312,13 @@ namespace lot {
     }
 
     std::vector<const char *> LotDevice::getRequiredExtensions() {
-        uint32_t glfwExtensionCount = 0;
-        const char **glfwExtensions;
-        glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-
-        std::vector<const char *> extensions(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        std::vector<const char *> extensions;
+        if (!isHeadless()) {
+            uint32_t glfwExtensionCount = 0;
+            const char **glfwExtensions;
+            glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+            extensions.assign(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        }
 
         if (enableValidationLayers) {
             extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
@@ -313,11 +371,19 @@ namespace lot {
                 indices.graphicsFamily = i;
                 indices.graphicsFamilyHasValue = true;
             }
-            VkBool32 presentSupport = false;
-            vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface_, &presentSupport);
-            if (queueFamily.queueCount > 0 && presentSupport) {
-                indices.presentFamily = i;
-                indices.presentFamilyHasValue = true;
+            if (isHeadless()) {
+                // 프레젠트 큐가 없으므로 그래픽스 큐로 대신함
+                if (indices.graphicsFamilyHasValue) {
+                    indices.presentFamily = indices.graphicsFamily;
+                    indices.presentFamilyHasValue = true;
+                }
+            } else {
+                VkBool32 presentSupport = false;
+                vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface_, &presentSupport);
+                if (queueFamily.queueCount > 0 && presentSupport) {
+                    indices.presentFamily = i;
+                    indices.presentFamilyHasValue = true;
+                }
             }
             if (indices.isComplete()) {
                 break;
@@ -369,6 +435,7 @@ namespace lot {
         std::vector<VkExtensionProperties> availableExtensions(extensionCount);
         vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
 
+        auto deviceExtensions = getDeviceExtensions();
         std::set<std::string> requiredExtensions(deviceExtensions.begin(), deviceExtensions.end());
 
         for (const auto& extension : availableExtensions) {
@@ -378,6 +445,17 @@ namespace lot {
         return requiredExtensions.empty();
     }
 
+    std::vector<const char *> LotDevice::getDeviceExtensions() const {
+        std::vector<const char *> extensions;
+        if (!isHeadless()) {
+            extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+        }
+        #ifdef __APPLE__
+            extensions.push_back(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME);
+        #endif
+        return extensions;
+    }
+
     SwapChainSupportDetails LotDevice::querySwapChainSupport(VkPhysicalDevice device) {
         SwapChainSupportDetails details;
         vkGetPhysicalDeviceSurfaceCapabilitiesKHR(device, surface_, &details.capabilities);
@@ -428,9 +506,11 @@ namespace lot {
         allocInfo.allocationSize = memRequirements.size;
         allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
 
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::AllocateMemory);
         if (vkAllocateMemory(device_, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS) {
             throw std::runtime_error("failed to allocate vertex buffer memory");
         }
+        trackAllocation(bufferMemory, allocInfo.allocationSize);
 
         vkBindBufferMemory(device_, buffer, bufferMemory, 0);
     }
@@ -443,6 +523,7 @@ namespace lot {
         allocInfo.commandBufferCount = 1;
 
         VkCommandBuffer commandBuffer;
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::AllocateCommandBuffers);
         vkAllocateCommandBuffers(device_, &allocInfo, &commandBuffer);
 
         VkCommandBufferBeginInfo beginInfo{};
@@ -454,6 +535,7 @@ namespace lot {
     }
 
     void LotDevice::endSingleTimeCommands(VkCommandBuffer commandBuffer) {
+        LOT_PROFILE_SCOPE("LotDevice::endSingleTimeCommands");
         vkEndCommandBuffer(commandBuffer);
 
         VkSubmitInfo submitInfo{};
@@ -461,8 +543,14 @@ namespace lot {
         submitInfo.commandBufferCount = 1;
         submitInfo.pCommandBuffers = &commandBuffer;
 
-        vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
-        vkQueueWaitIdle(graphicsQueue_);
+        {
+            // 렌더 스레드의 제출/프레젠트와 경합하지 않도록 큐 잠금
+            std::lock_guard<std::mutex> lock{queueMutex_};
+            LotFlightRecorder::countVulkanCall(LotVulkanCall::QueueSubmit);
+            vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
+            LotFlightRecorder::countVulkanCall(LotVulkanCall::QueueWaitIdle);
+            vkQueueWaitIdle(graphicsQueue_);
+        }
 
         vkFreeCommandBuffers(device_, commandPool, 1, &commandBuffer);
     }
@@ -477,6 +565,7 @@ namespace lot {
         vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
 
         endSingleTimeCommands(commandBuffer);
+        uploadBytes().add(size);
     }
 
     void LotDevice::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, 
@@ -514,13 +603,55 @@ namespace lot {
         allocInfo.allocationSize = memRequirements.size;
         allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
 
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::AllocateMemory);
         if (vkAllocateMemory(device_, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
             throw std::runtime_error("failed to allocate image memory!");
         }
+        trackAllocation(imageMemory, allocInfo.allocationSize);
 
         if (vkBindImageMemory(device_, image, imageMemory, 0) != VK_SUCCESS) {
             throw std::runtime_error("failed to bind image memory!");
         }
     }
 
+    VkDeviceMemory LotDevice::allocateMemory(VkDeviceSize size, uint32_t memoryTypeIndex) {
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = size;
+        allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::AllocateMemory);
+        if (vkAllocateMemory(device_, &allocInfo, nullptr, &memory) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate memory!");
+        }
+        trackAllocation(memory, size);
+        return memory;
+    }
+
+    void LotDevice::trackAllocation(VkDeviceMemory memory, VkDeviceSize size) {
+        {
+            std::lock_guard<std::mutex> lock{memoryMutex_};
+            memoryAllocations_[memory] = size;
+        }
+        gpuMemoryBytes().add(static_cast<double>(size));
+    }
+
+    void LotDevice::freeMemory(VkDeviceMemory memory) {
+        if (memory == VK_NULL_HANDLE) {
+            return;
+        }
+        VkDeviceSize size = 0;
+        {
+            std::lock_guard<std::mutex> lock{memoryMutex_};
+            auto it = memoryAllocations_.find(memory);
+            if (it != memoryAllocations_.end()) {
+                size = it->second;
+                memoryAllocations_.erase(it);
+            }
+        }
+        vkFreeMemory(device_, memory, nullptr);
+        gpuMemoryBytes().add(-static_cast<double>(size));
+    }
+
 } // namespace lot
\ No newline at end of file
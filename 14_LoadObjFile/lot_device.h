@@ -1,8 +1,14 @@
 #pragma once
 
 #include "lot_window.h"
+#include "lot_deletion_queue.h"
+#include "lot_pipeline_cache.h"
+#include "lot_shader_library.h"
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #ifdef __APPLE__
     #include "vulkan/vulkan_beta.h"
@@ -33,7 +39,8 @@ namespace lot {
                 const bool enableValidationLayers = true;
             #endif
 
-            LotDevice(LotWindow &window);
+            // window가 nullptr이면 서피스/스왑체인 없이 생성 (헤드리스 오프스크린 렌더링)
+            explicit LotDevice(LotWindow *window);
             ~LotDevice();
 
             // Not copyable or movable
@@ -47,6 +54,23 @@ namespace lot {
             VkSurfaceKHR surface() { return surface_; }
             VkQueue graphicsQueue() { return graphicsQueue_; }
             VkQueue presentQueue() { return presentQueue_; }
+            bool isHeadless() const { return window == nullptr; }
+
+            // GPU 프로파일러용: 그래픽스 큐 타임스탬프의 유효 비트 수 (0이면 미지원)
+            uint32_t timestampValidBits() const { return timestampValidBits_; }
+            // 파이프라인 통계 쿼리와 보조 커맨드 버퍼의 쿼리 상속이 모두 켜졌는지
+            bool supportsPipelineStatistics() const { return pipelineStatisticsEnabled_; }
+
+            // 모든 파이프라인 생성이 공유하는 디스크 캐시 (소멸 시 저장)
+            VkPipelineCache pipelineCache() { return pipelineCache_->getPipelineCache(); }
+            LotPipelineCache& getPipelineCache() { return *pipelineCache_; }
+            // 경로/내용 해시로 중복을 제거하는 셰이더 모듈 레지스트리
+            LotShaderLibrary& getShaderLibrary() { return *shaderLibrary_; }
+            // 프레임에서 참조했을 수 있는 버퍼/이미지/파이프라인은 즉시 파괴하지 말고 여기로 넘김
+            LotDeletionQueue& deletionQueue() { return *deletionQueue_; }
+
+            // 큐 제출은 외부 동기화가 필요하므로 여러 스레드에서 제출할 때 이 뮤텍스를 잡는다
+            std::mutex& queueMutex() { return queueMutex_; }
 
             SwapChainSupportDetails getSwapChainSupport() { return querySwapChainSupport(physicalDevice); }
             uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
@@ -61,6 +85,7 @@ namespace lot {
                 VkMemoryPropertyFlags properties,
                 VkBuffer &buffer,
                 VkDeviceMemory &bufferMemory);
+            VkCommandPool createGraphicsCommandPool(VkCommandPoolCreateFlags flags);
             VkCommandBuffer beginSingleTimeCommands();
             void endSingleTimeCommands(VkCommandBuffer commandBuffer);
             void copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
@@ -72,6 +97,10 @@ namespace lot {
                 VkMemoryPropertyFlags properties,
                 VkImage &image,
                 VkDeviceMemory &imageMemory);
+            // 여러 이미지가 차례로 바인딩해 쓸 메모리를 직접 할당 (스왑체인 깊이 버퍼 재사용)
+            VkDeviceMemory allocateMemory(VkDeviceSize size, uint32_t memoryTypeIndex);
+            // createBuffer/createImageWithInfo/allocateMemory로 할당한 메모리 해제 (gpu_memory_bytes 지표 갱신)
+            void freeMemory(VkDeviceMemory memory);
 
             VkPhysicalDeviceProperties properties;
 
@@ -82,6 +111,7 @@ namespace lot {
             void pickPhysicalDevice();
             void createLogicalDevice();
             void createCommandPool();
+            void createPipelineCache();
 
             // helper functions
             bool isDeviceSuitable(VkPhysicalDevice device);
@@ -91,25 +121,30 @@ namespace lot {
             void populateDebugMessengerCreateInfo(VkDebugUtilsMessengerCreateInfoEXT &createInfo);
             void hasGlfwRequiredInstanceExtensions();
             bool checkDeviceExtensionSupport(VkPhysicalDevice device);
+            std::vector<const char *> getDeviceExtensions() const;
             SwapChainSupportDetails querySwapChainSupport(VkPhysicalDevice device);
+            void trackAllocation(VkDeviceMemory memory, VkDeviceSize size);
 
             VkInstance instance;
             VkDebugUtilsMessengerEXT debugMessenger;
             VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
-            LotWindow &window;
+            LotWindow *window;
             VkCommandPool commandPool;
 
             VkDevice device_;
-            VkSurfaceKHR surface_;
+            VkSurfaceKHR surface_ = VK_NULL_HANDLE;
             VkQueue graphicsQueue_;
             VkQueue presentQueue_;
+            std::mutex queueMutex_;
+            // 할당 크기 추적 (해제 시 사용량에서 빼기 위해)
+            std::mutex memoryMutex_;
+            std::unordered_map<VkDeviceMemory, VkDeviceSize> memoryAllocations_;
+            uint32_t timestampValidBits_ = 0;
+            bool pipelineStatisticsEnabled_ = false;
+            std::unique_ptr<LotPipelineCache> pipelineCache_;
+            std::unique_ptr<LotShaderLibrary> shaderLibrary_;
+            std::unique_ptr<LotDeletionQueue> deletionQueue_;
 
             const std::vector<const char *> validationLayers = {"VK_LAYER_KHRONOS_validation"};
-            const std::vector<const char *> deviceExtensions = {
-                VK_KHR_SWAPCHAIN_EXTENSION_NAME,
-            #ifdef __APPLE__ 
-                VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME, 
-            #endif
-                /*VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME */};
     };
 }
\ No newline at end of file
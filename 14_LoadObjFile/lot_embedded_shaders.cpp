@@ -0,0 +1,34 @@
+#include "lot_embedded_shaders.h"
+
+// std
+#include <cstring>
+#include <iterator>
+
+namespace lot {
+    namespace {
+    #ifdef LOT_EMBEDDED_SHADERS
+        // 빌드 디렉터리의 generated/lot_embedded_shaders.inc (EMBEDDED_SHADERS 테이블 정의)
+        #include "lot_embedded_shaders.inc"
+
+        const LotEmbeddedShader *embeddedBegin() { return std::begin(EMBEDDED_SHADERS); }
+        const LotEmbeddedShader *embeddedEnd() { return std::end(EMBEDDED_SHADERS); }
+    #else
+        const LotEmbeddedShader *embeddedBegin() { return nullptr; }
+        const LotEmbeddedShader *embeddedEnd() { return nullptr; }
+    #endif
+    }
+
+    const LotEmbeddedShader *LotEmbeddedShaders::find(const std::string &name) {
+        // 셰이더 수가 적으므로 선형 탐색
+        for (const LotEmbeddedShader *shader = embeddedBegin(); shader != embeddedEnd(); ++shader) {
+            if (std::strcmp(shader->name, name.c_str()) == 0) {
+                return shader;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t LotEmbeddedShaders::count() {
+        return static_cast<size_t>(embeddedEnd() - embeddedBegin());
+    }
+} // namespace lot
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace lot {
+    // 빌드 시 실행 파일에 포함된 SPIR-V (cmake/embed_spirv.cmake가 생성)
+    struct LotEmbeddedShader {
+        const char *name;        // 예: "shaders/simple_shader.vert.spv"
+        const uint32_t *code;
+        size_t codeSize;         // 바이트 단위
+    };
+
+    // 이름으로 포함된 셰이더를 찾는 레지스트리
+    // LOT_EMBED_SHADERS 옵션을 끄고 빌드하면 비어 있음
+    class LotEmbeddedShaders {
+        public:
+            static const LotEmbeddedShader *find(const std::string &name);
+            static size_t count();
+    };
+} // namespace lot
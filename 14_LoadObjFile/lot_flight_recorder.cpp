@@ -0,0 +1,283 @@
+#include "lot_flight_recorder.h"
+#include "lot_log.h"
+
+// std
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+
+#ifdef _WIN32
+    #include <malloc.h>
+#endif
+
+namespace {
+    std::atomic<uint64_t> allocationCounter{0};
+
+    // 정렬 할당 (MSVC는 aligned_alloc이 없고 _aligned_malloc 메모리는 _aligned_free로 해제해야 함)
+    void *alignedMalloc(std::size_t size, std::size_t alignment) {
+    #ifdef _WIN32
+        return _aligned_malloc(size, alignment);
+    #else
+        // aligned_alloc은 크기가 정렬의 배수여야 함
+        std::size_t roundedSize = (size + alignment - 1) & ~(alignment - 1);
+        if (roundedSize < size) {
+            return nullptr;
+        }
+        return std::aligned_alloc(alignment, roundedSize);
+    #endif
+    }
+
+    void alignedFree(void *memory) {
+    #ifdef _WIN32
+        _aligned_free(memory);
+    #else
+        std::free(memory);
+    #endif
+    }
+}
+
+// 할당 수를 세기 위한 전역 operator new/delete 교체 (나머지 형태는 표준상 이 함수들을 거침)
+void *operator new(std::size_t size) {
+    allocationCounter.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    // 기본 구현과 같이 실패하면 new-handler를 호출하고 다시 시도 (핸들러가 없을 때만 bad_alloc)
+    while (true) {
+        if (void *memory = std::malloc(size)) {
+            return memory;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc{};
+        }
+        handler();
+    }
+}
+
+void *operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+// 정렬 요구가 큰 타입(alignas 캐시 라인 등)의 할당도 같은 카운터로 셈
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    allocationCounter.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        if (void *memory = alignedMalloc(size, static_cast<std::size_t>(alignment))) {
+            return memory;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc{};
+        }
+        handler();
+    }
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return ::operator new(size, alignment);
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept {
+    alignedFree(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t) noexcept {
+    alignedFree(memory);
+}
+
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept {
+    alignedFree(memory);
+}
+
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept {
+    alignedFree(memory);
+}
+
+namespace lot {
+    const char *const LotFlightRecorder::VULKAN_CALL_NAMES[VULKAN_CALL_COUNT] = {
+        "vkQueueSubmit",
+        "vkQueuePresentKHR",
+        "vkAcquireNextImageKHR",
+        "vkWaitForFences",
+        "vkQueueWaitIdle",
+        "vkDeviceWaitIdle",
+        "vkAllocateMemory",
+        "vkAllocateCommandBuffers",
+        "vkAllocateDescriptorSets",
+        "vkCreateGraphicsPipelines",
+    };
+
+    std::array<std::atomic<uint64_t>, LotFlightRecorder::VULKAN_CALL_COUNT> LotFlightRecorder::vulkanCallCounters{};
+
+    LotFlightRecorder::Config LotFlightRecorder::configFromEnvironment() {
+        Config config{};
+        if (const char *env = std::getenv("LOT_HITCH_MS")) {
+            config.hitchThresholdMs = std::stod(env);
+        }
+        if (const char *env = std::getenv("LOT_HITCH_DIR")) {
+            config.dumpDirectory = env;
+        }
+        return config;
+    }
+
+    uint64_t LotFlightRecorder::allocationCount() {
+        return allocationCounter.load(std::memory_order_relaxed);
+    }
+
+    LotFlightRecorder::LotFlightRecorder(const char *name, Config config)
+    : name{name}, config{std::move(config)}, createdTime{Clock::now()} {
+        if (this->config.capacity == 0) {
+            throw std::runtime_error("flight recorder capacity must be greater than zero");
+        }
+        // 기록 중에는 할당하지 않도록 링을 미리 채워 둠
+        frames.resize(this->config.capacity);
+    }
+
+    void LotFlightRecorder::beginFrame() {
+        Clock::time_point now = Clock::now();
+        current = FrameRecord{};
+        current.frameNumber = frameCount;
+        current.startMs = std::chrono::duration<double, std::milli>(now - createdTime).count();
+        frameActive = true;
+        frameStart = now;
+        phaseStart = now;
+        activePhase = MAX_PHASES;
+
+        allocationsAtStart = allocationCount();
+        for (uint32_t i = 0; i < VULKAN_CALL_COUNT; i++) {
+            vulkanCallsAtStart[i] = vulkanCallCounters[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t LotFlightRecorder::phaseIndex(const char *phaseName) {
+        for (uint32_t i = 0; i < phaseCount; i++) {
+            if (phaseNames[i] == phaseName || std::strcmp(phaseNames[i], phaseName) == 0) {
+                return i;
+            }
+        }
+        if (phaseCount == MAX_PHASES) {
+            return MAX_PHASES;
+        }
+        phaseNames[phaseCount] = phaseName;
+        return phaseCount++;
+    }
+
+    void LotFlightRecorder::closePhase(Clock::time_point now) {
+        if (activePhase < MAX_PHASES) {
+            current.phaseMs[activePhase] += std::chrono::duration<double, std::milli>(now - phaseStart).count();
+        }
+        phaseStart = now;
+    }
+
+    void LotFlightRecorder::beginPhase(const char *phaseName) {
+        if (!frameActive) {
+            return;
+        }
+        closePhase(Clock::now());
+        activePhase = phaseIndex(phaseName);
+    }
+
+    void LotFlightRecorder::endFrame() {
+        if (!frameActive) {
+            return;
+        }
+        Clock::time_point now = Clock::now();
+        closePhase(now);
+        frameActive = false;
+
+        current.totalMs = std::chrono::duration<double, std::milli>(now - frameStart).count();
+        current.allocations = allocationCount() - allocationsAtStart;
+        for (uint32_t i = 0; i < VULKAN_CALL_COUNT; i++) {
+            current.vulkanCalls[i] = static_cast<uint32_t>(
+                vulkanCallCounters[i].load(std::memory_order_relaxed) - vulkanCallsAtStart[i]);
+        }
+        frames[frameCount % frames.size()] = current;
+        frameCount++;
+
+        bool isHitch = config.hitchThresholdMs > 0.0 && current.totalMs > config.hitchThresholdMs &&
+                       current.frameNumber >= config.warmupFrames;
+        if (!isHitch) {
+            return;
+        }
+        hitchCount++;
+        if (hasDumped && current.frameNumber - lastDumpFrame < config.dumpCooldownFrames) {
+            return;
+        }
+        dumpHitch(current);
+    }
+
+    void LotFlightRecorder::dumpHitch(const FrameRecord &record) {
+        hasDumped = true;
+        lastDumpFrame = record.frameNumber;
+
+        std::string filepath = config.dumpDirectory + "/hitch_" + name + "_" +
+                               std::to_string(record.frameNumber) + ".json";
+        // 진단용 기능이므로 저장 실패로 프레임 루프를 멈추지 않음
+        try {
+            writeJson(filepath, record.frameNumber);
+        } catch (const std::exception &e) {
+            LOT_LOG_ERROR("[FlightRecorder] {}", std::string{e.what()});
+            return;
+        }
+        LOT_LOG_WARN("[FlightRecorder] {} frame {} took {} ms (threshold {} ms), wrote {} frames to {}",
+                     name, record.frameNumber, record.totalMs, config.hitchThresholdMs,
+                     std::min<uint64_t>(frameCount, frames.size()), filepath);
+    }
+
+    void LotFlightRecorder::writeJson(const std::string &filepath, uint64_t hitchFrame) const {
+        std::ofstream file{filepath, std::ios::trunc};
+        if (!file.is_open()) {
+            throw std::runtime_error("failed to open file: " + filepath);
+        }
+
+        file << "{\n  \"recorder\": \"" << name << "\",\n  \"thresholdMs\": " << config.hitchThresholdMs
+             << ",\n  \"hitchFrame\": " << hitchFrame << ",\n  \"phases\": [";
+        for (uint32_t i = 0; i < phaseCount; i++) {
+            file << (i == 0 ? "" : ", ") << "\"" << phaseNames[i] << "\"";
+        }
+        file << "],\n  \"vulkanCalls\": [";
+        for (uint32_t i = 0; i < VULKAN_CALL_COUNT; i++) {
+            file << (i == 0 ? "" : ", ") << "\"" << VULKAN_CALL_NAMES[i] << "\"";
+        }
+        file << "],\n  \"frames\": [";
+
+        uint64_t recorded = std::min<uint64_t>(frameCount, frames.size());
+        for (uint64_t n = frameCount - recorded; n < frameCount; n++) {
+            const auto &frame = frames[n % frames.size()];
+            file << (n == frameCount - recorded ? "\n" : ",\n") << "    {\"frame\": " << frame.frameNumber
+                 << ", \"startMs\": " << frame.startMs << ", \"totalMs\": " << frame.totalMs << ", \"phaseMs\": [";
+            for (uint32_t i = 0; i < phaseCount; i++) {
+                file << (i == 0 ? "" : ", ") << frame.phaseMs[i];
+            }
+            file << "], \"allocations\": " << frame.allocations << ", \"vulkanCalls\": [";
+            for (uint32_t i = 0; i < VULKAN_CALL_COUNT; i++) {
+                file << (i == 0 ? "" : ", ") << frame.vulkanCalls[i];
+            }
+            file << "]}";
+        }
+        file << "\n  ]\n}\n";
+    }
+} // namespace lot
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lot {
+    // 프레임 구간 안에서 몇 번 불렸는지 세는 Vulkan 호출 (호출 지점에서 countVulkanCall로 증가)
+    enum class LotVulkanCall : uint32_t {
+        QueueSubmit,
+        QueuePresent,
+        AcquireNextImage,
+        WaitForFences,
+        QueueWaitIdle,
+        DeviceWaitIdle,
+        AllocateMemory,
+        AllocateCommandBuffers,
+        AllocateDescriptorSets,
+        CreateGraphicsPipelines,
+        Count
+    };
+
+    // 프레임 히치 분석용 플라이트 레코더
+    // - 최근 capacity 프레임의 구간별 시간, 메모리 할당 수, Vulkan 호출 수를 고정 크기 링에 보관
+    // - 프레임이 임계값을 넘으면 그 시점의 링 전체를 JSON으로 저장 (재현하지 않고 사후 분석)
+    // - 레코더 하나는 한 스레드의 프레임 루프 전용이며, 할당/Vulkan 호출 수는 프로세스 전체 카운터의
+    //   프레임 구간 차이이므로 다른 스레드의 호출도 포함됨 (큐 잠금을 통한 간접 지연을 찾는 데 유용)
+    class LotFlightRecorder {
+        public:
+            static constexpr uint32_t MAX_PHASES = 8;
+            static constexpr uint32_t VULKAN_CALL_COUNT = static_cast<uint32_t>(LotVulkanCall::Count);
+            static const char *const VULKAN_CALL_NAMES[VULKAN_CALL_COUNT];
+
+            struct Config {
+                size_t capacity = 300;
+                // 0 이하이면 저장하지 않고 기록만 함
+                double hitchThresholdMs = 50.0;
+                // 시작 직후의 파이프라인 컴파일/업로드는 히치로 보지 않음
+                uint64_t warmupFrames = 30;
+                // 저장 직후의 프레임(파일 I/O 포함)과 연속된 히치로 파일이 쌓이지 않도록 하는 간격
+                uint64_t dumpCooldownFrames = 120;
+                std::string dumpDirectory = ".";
+            };
+            // LOT_HITCH_MS(임계값, 0이면 저장 안 함)와 LOT_HITCH_DIR(저장 폴더) 환경 변수 반영
+            static Config configFromEnvironment();
+
+            struct FrameRecord {
+                uint64_t frameNumber = 0;
+                // 레코더 생성 시점 기준
+                double startMs = 0.0;
+                double totalMs = 0.0;
+                std::array<double, MAX_PHASES> phaseMs{};
+                uint64_t allocations = 0;
+                std::array<uint32_t, VULKAN_CALL_COUNT> vulkanCalls{};
+            };
+
+            // name은 정적 문자열 (파일 이름과 로그에 사용)
+            LotFlightRecorder(const char *name, Config config);
+
+            LotFlightRecorder(const LotFlightRecorder &) = delete;
+            LotFlightRecorder &operator=(const LotFlightRecorder &) = delete;
+
+            // 아래는 레코더를 소유한 스레드 전용
+            void beginFrame();
+            // 현재 구간을 닫고 name 구간을 시작 (name은 정적 문자열, 새 이름은 MAX_PHASES개까지 등록)
+            void beginPhase(const char *name);
+            // 현재 구간을 닫고 프레임을 링에 기록, 임계값을 넘으면 저장
+            void endFrame();
+            // 링에 남은 프레임을 오래된 것부터 JSON으로 저장
+            void writeJson(const std::string &filepath, uint64_t hitchFrame) const;
+
+            const std::vector<FrameRecord> &getFrames() const { return frames; }
+            uint64_t getFrameCount() const { return frameCount; }
+            uint64_t getHitchCount() const { return hitchCount; }
+            // 마지막으로 끝낸 프레임 (다음 beginFrame 전까지 유효)
+            const FrameRecord &getLastFrame() const { return current; }
+            uint32_t getPhaseCount() const { return phaseCount; }
+            const char *getPhaseName(uint32_t index) const { return phaseNames[index]; }
+
+            // 어느 스레드에서나 호출 가능
+            static void countVulkanCall(LotVulkanCall call) {
+                vulkanCallCounters[static_cast<uint32_t>(call)].fetch_add(1, std::memory_order_relaxed);
+            }
+            // 전역 operator new 호출 수 (정렬 지정 할당은 세지 않음)
+            static uint64_t allocationCount();
+
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            uint32_t phaseIndex(const char *name);
+            void closePhase(Clock::time_point now);
+            void dumpHitch(const FrameRecord &record);
+
+            static std::array<std::atomic<uint64_t>, VULKAN_CALL_COUNT> vulkanCallCounters;
+
+            const char *name;
+            Config config;
+            Clock::time_point createdTime;
+
+            std::vector<FrameRecord> frames;
+            uint64_t frameCount = 0;
+            uint64_t hitchCount = 0;
+            uint64_t lastDumpFrame = 0;
+            bool hasDumped = false;
+
+            std::array<const char *, MAX_PHASES> phaseNames{};
+            uint32_t phaseCount = 0;
+
+            // 진행 중인 프레임
+            FrameRecord current{};
+            bool frameActive = false;
+            Clock::time_point frameStart{};
+            Clock::time_point phaseStart{};
+            uint32_t activePhase = MAX_PHASES;
+            uint64_t allocationsAtStart = 0;
+            std::array<uint64_t, VULKAN_CALL_COUNT> vulkanCallsAtStart{};
+    };
+} // namespace lot
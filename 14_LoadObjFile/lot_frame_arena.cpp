@@ -0,0 +1,91 @@
+#include "lot_frame_arena.h"
+
+// std
+#include <algorithm>
+#include <cstdint>
+
+namespace lot {
+    namespace {
+        // 스크래치는 스레드마다 작게 시작 (대부분 수 KB 이하의 질의용 배열)
+        constexpr size_t SCRATCH_CAPACITY = 16 * 1024;
+    }
+
+    LotFrameArena::LotFrameArena(size_t initialCapacity) {
+        addBlock(std::max<size_t>(initialCapacity, 1));
+    }
+
+    void LotFrameArena::reset() {
+        highWater = std::max(highWater, usedBytes());
+        // 지난 주기에 블록이 늘었다면 전체 크기의 블록 하나로 합쳐 다음 주기부터는 넘치지 않게 함
+        if (blocks.size() > 1) {
+            size_t total = getCapacity();
+            blocks.clear();
+            addBlock(total);
+        }
+        currentBlock = 0;
+        offset = 0;
+    }
+
+    void LotFrameArena::rewind(Marker marker) {
+        highWater = std::max(highWater, usedBytes());
+        currentBlock = marker.block;
+        offset = marker.offset;
+    }
+
+    void LotFrameArena::endScope(Marker marker) {
+        assert(scopeDepth > 0 && "endScope without beginScope");
+        scopeDepth--;
+        rewind(marker);
+        // 블록을 합치면 기존 블록이 해제되므로 바깥 스코프가 살아 있는 동안에는 되감기만 함
+        if (scopeDepth == 0 && currentBlock == 0 && offset == 0) {
+            reset();
+        }
+    }
+
+    size_t LotFrameArena::getCapacity() const {
+        size_t total = 0;
+        for (const auto &block : blocks) {
+            total += block.size;
+        }
+        return total;
+    }
+
+    void *LotFrameArena::do_allocate(size_t bytes, size_t alignment) {
+        while (true) {
+            Block &block = blocks[currentBlock];
+            auto base = reinterpret_cast<std::uintptr_t>(block.data.get());
+            size_t aligned = ((base + offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1)) - base;
+            if (aligned + bytes <= block.size) {
+                offset = aligned + bytes;
+                return block.data.get() + aligned;
+            }
+
+            // 되감은 뒤 남아 있는 다음 블록을 먼저 재사용하고, 없으면 새로 잡음
+            if (currentBlock + 1 == blocks.size()) {
+                addBlock(std::max(block.size * 2, bytes + alignment));
+            }
+            currentBlock++;
+            offset = 0;
+        }
+    }
+
+    void LotFrameArena::addBlock(size_t minSize) {
+        Block block;
+        block.size = minSize;
+        block.data = std::make_unique<std::byte[]>(minSize);
+        blocks.push_back(std::move(block));
+    }
+
+    size_t LotFrameArena::usedBytes() const {
+        size_t used = offset;
+        for (size_t i = 0; i < currentBlock; i++) {
+            used += blocks[i].size;
+        }
+        return used;
+    }
+
+    LotFrameArena &LotScratchScope::threadArena() {
+        thread_local LotFrameArena arena{SCRATCH_CAPACITY};
+        return arena;
+    }
+} // namespace lot
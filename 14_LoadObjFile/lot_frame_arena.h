@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace lot {
+    // 프레임 단위 임시 데이터용 선형(bump) 할당기
+    // - 해제는 개별로 하지 않고 reset()/rewind()로 한꺼번에 (deallocate는 아무것도 하지 않음)
+    // - std::pmr 컨테이너에 그대로 넘길 수 있음: std::pmr::vector<T> v{&arena};
+    // - 용량이 모자라면 블록을 더 잡고, 다음 reset()에서 하나로 합치므로 정상 상태에서는 힙 할당이 없음
+    // 한 아레나는 한 스레드에서만 할당 (렌더 스레드의 프레임 슬롯별 아레나, 스레드별 스크래치)
+    class LotFrameArena : public std::pmr::memory_resource {
+        public:
+            static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+            // 되감기 지점 (LotScratchScope가 사용)
+            struct Marker {
+                size_t block = 0;
+                size_t offset = 0;
+            };
+
+            explicit LotFrameArena(size_t initialCapacity = DEFAULT_CAPACITY);
+
+            LotFrameArena(const LotFrameArena &) = delete;
+            LotFrameArena &operator=(const LotFrameArena &) = delete;
+
+            // 모든 할당을 버림 (이 아레나에서 받은 메모리를 쓰는 컨테이너가 남아 있으면 안 됨)
+            void reset();
+            Marker mark() const { return {currentBlock, offset}; }
+            // mark() 이후의 할당만 버림
+            void rewind(Marker marker);
+
+            // 중첩 스코프 (LotScratchScope가 사용). 가장 바깥 스코프가 끝나 아레나가 비면 블록도 합침
+            Marker beginScope() {
+                scopeDepth++;
+                return mark();
+            }
+            void endScope(Marker marker);
+
+            size_t getCapacity() const;
+            // reset() 사이에 가장 많이 쓴 바이트 수
+            size_t getHighWater() const { return highWater; }
+
+        protected:
+            void *do_allocate(size_t bytes, size_t alignment) override;
+            void do_deallocate(void *, size_t, size_t) override {}
+            bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+        private:
+            struct Block {
+                std::unique_ptr<std::byte[]> data;
+                size_t size = 0;
+            };
+
+            void addBlock(size_t minSize);
+            size_t usedBytes() const;
+
+            std::vector<Block> blocks;
+            size_t currentBlock = 0;
+            size_t offset = 0;
+            size_t highWater = 0;
+            size_t scopeDepth = 0;
+    };
+
+    // 호출 스레드의 스크래치 아레나에서 잠깐 쓰는 메모리 (스코프가 끝나면 시작 지점으로 되감음)
+    // 중첩 가능하며, 스코프 안에서 만든 pmr 컨테이너는 스코프보다 먼저 소멸해야 함
+    //   LotScratchScope scratch;
+    //   std::pmr::vector<float> distances{count, 0.f, scratch.resource()};
+    class LotScratchScope {
+        public:
+            LotScratchScope() : arena{threadArena()}, marker{arena.beginScope()} {}
+            ~LotScratchScope() { arena.endScope(marker); }
+
+            LotScratchScope(const LotScratchScope &) = delete;
+            LotScratchScope &operator=(const LotScratchScope &) = delete;
+
+            std::pmr::memory_resource *resource() { return &arena; }
+
+            static LotFrameArena &threadArena();
+
+        private:
+            LotFrameArena &arena;
+            LotFrameArena::Marker marker;
+    };
+} // namespace lot
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "keyboard_move_ctrl.h"
+#include "lot_camera.h"
+#include "lot_frame_arena.h"
+#include "lot_game_object.h"
+#include "lot_thread_command_pools.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace lot {
+    // 프레임별 전역 유니폼 버퍼 (set 0, binding 0, std140)
+    struct GlobalUbo {
+        glm::mat4 projection{1.f};
+        glm::mat4 view{1.f};
+        glm::mat4 inverseView{1.f};
+        glm::mat4 projectionView{1.f};
+        glm::vec4 viewportSize{0.f};   // xy: 크기, zw: 역수
+        float time{0.f};
+        float frameTime{0.f};
+        uint32_t frameNumber{0};
+    };
+
+    // 객체별 데이터 (set 0, binding 1 스토리지 버퍼, std430)
+    // 드로우는 푸시 상수로 이 배열의 인덱스만 넘김
+    struct ObjectData {
+        glm::mat4 modelMatrix{1.f};
+        glm::vec4 color{0.f};
+        int32_t isSelected{0};
+        int32_t padding[3]{};
+    };
+    static_assert(sizeof(ObjectData) == 96, "ObjectData must match the std430 layout in simple_shader.vert");
+
+    // 렌더 스레드로 넘기는 객체 단위 불변 데이터
+    struct RenderObject {
+        LotGameObject::id_t id{0};
+        std::shared_ptr<LotModel> model{};
+        glm::mat4 modelMatrix{1.f};
+        glm::vec3 color{};
+        bool isSelected{false};
+    };
+
+    // 메인(입력) 스레드가 매 프레임 만들어 렌더 스레드에 넘기는 스냅샷
+    struct FrameSnapshot {
+        uint64_t frameNumber{0};
+        // 그릴 객체 목록이 바뀔 때(추가/삭제/선택) 증가. 이동/카메라는 버퍼로 전달되므로 포함하지 않음
+        uint64_t sceneVersion{0};
+        float frameTime{0.f};
+        // 이 스냅샷의 입력을 읽은 시각 (입력 ~ 프레젠트 지연 측정용, 입력 없이 만든 스냅샷은 기본값)
+        std::chrono::steady_clock::time_point inputTime{};
+        LotCamera camera{};
+        KeyboardMoveCtrl::ProjectionType projectionType{KeyboardMoveCtrl::ProjectionType::Perspective};
+        std::vector<RenderObject> objects;
+    };
+
+    // 메인 스레드가 반복마다 갱신하는 최신 카메라
+    // 렌더 스레드는 이전에 받은 스냅샷을 그리더라도 제출 직전에 이 값으로 카메라 유니폼을 씀 (late latch)
+    struct LatchedCamera {
+        std::chrono::steady_clock::time_point inputTime{};
+        LotCamera camera{};
+        KeyboardMoveCtrl::ProjectionType projectionType{KeyboardMoveCtrl::ProjectionType::Perspective};
+    };
+
+    // 렌더 시스템에 전달되는 프레임 단위 정보
+    struct FrameInfo {
+        int frameIndex;
+        float frameTime;
+        VkCommandBuffer commandBuffer;
+        const LotCamera& camera;
+
+        // 보조 커맨드 버퍼 상속 정보
+        VkRenderPass renderPass;
+        VkFramebuffer framebuffer;
+        VkExtent2D extent;
+        LotThreadCommandPools& threadCommandPools;
+
+        VkDescriptorSet globalDescriptorSet;
+        uint64_t sceneVersion;
+        // 디스크립터 셋 내용이 바뀔 때(객체 버퍼 재할당) 증가
+        uint64_t descriptorVersion;
+
+        // 이 프레임 슬롯 전용 임시 메모리 (드로우 목록 등, 다음에 같은 슬롯을 쓸 때 비워짐)
+        LotFrameArena& frameArena;
+    };
+} // namespace lot
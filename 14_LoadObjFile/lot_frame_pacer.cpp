@@ -0,0 +1,52 @@
+#include "lot_frame_pacer.h"
+#include "lot_cpu_profiler.h"
+
+// std
+#include <thread>
+
+namespace lot {
+    LotFramePacer::LotFramePacer(const LotFramePacerConfig &config)
+    : config{config},
+      latencyMs{LotMetrics::instance().histogram("input_to_present_ms", {4.0, 8.0, 16.7, 33.3, 50.0, 100.0})} {}
+
+    void LotFramePacer::waitForFrameSlot(uint64_t publishedFrame, const std::atomic<bool> &running) {
+        LOT_PROFILE_SCOPE("LotFramePacer::waitForFrameSlot");
+        if (config.maxFps > 0.f && lastFrameStart != Clock::time_point{}) {
+            auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / config.maxFps));
+            std::this_thread::sleep_until(lastFrameStart + interval);
+        }
+
+        if (config.maxQueuedFrames > 0) {
+            auto waitStart = Clock::now();
+            while (publishedFrame >= presentedFrame.load(std::memory_order_acquire) + config.maxQueuedFrames &&
+                   running.load(std::memory_order_acquire)) {
+                if (Clock::now() - waitStart > MAX_SLOT_WAIT) {
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+        lastFrameStart = Clock::now();
+    }
+
+    void LotFramePacer::framePresented(uint64_t frameNumber, Clock::time_point inputTime) {
+        // late latch로 다시 그린 프레임은 번호가 그대로이므로 지연만 기록
+        if (frameNumber > presentedFrame.load(std::memory_order_relaxed)) {
+            presentedFrame.store(frameNumber, std::memory_order_release);
+        }
+        if (inputTime == Clock::time_point{}) {
+            return;
+        }
+
+        double latency = std::chrono::duration<double, std::milli>(Clock::now() - inputTime).count();
+        latencyMs.observe(latency);
+        // 렌더 스레드만 쓰므로 읽고 쓰기를 나눠도 됨
+        latencySumMs.store(latencySumMs.load(std::memory_order_relaxed) + latency, std::memory_order_relaxed);
+        latencySamples.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    double LotFramePacer::getAverageLatencyMs() const {
+        uint64_t samples = latencySamples.load(std::memory_order_relaxed);
+        return samples == 0 ? 0.0 : latencySumMs.load(std::memory_order_relaxed) / static_cast<double>(samples);
+    }
+} // namespace lot
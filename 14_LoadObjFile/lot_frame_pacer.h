@@ -0,0 +1,53 @@
+#pragma once
+
+#include "lot_metrics.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace lot {
+    struct LotFramePacerConfig {
+        // 발행했지만 아직 프레젠트되지 않은 프레임 수 상한 (0이면 제한 없음)
+        // 1이면 이전 프레임이 프레젠트된 뒤에 입력을 읽으므로 입력 지연이 가장 짧음
+        uint32_t maxQueuedFrames{0};
+        // 초당 프레임 상한 (0이면 제한 없음)
+        float maxFps{0.f};
+    };
+
+    // 메인(입력) 스레드와 렌더 스레드 사이의 프레임 페이싱
+    // - 메인 스레드: 입력을 읽기 전에 waitForFrameSlot을 호출해 CPU가 프레젠트보다 앞서 나가는 프레임 수와 프레임률을 제한
+    // - 렌더 스레드: 프레젠트 직후 framePresented를 호출해 입력 샘플링 ~ vkQueuePresentKHR 반환까지의 지연을 기록
+    //   (지표 input_to_present_ms, 새 스냅샷이나 새로 latch한 입력을 프레젠트한 프레임만 보고할 것)
+    class LotFramePacer {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            explicit LotFramePacer(const LotFramePacerConfig &config);
+
+            LotFramePacer(const LotFramePacer &) = delete;
+            LotFramePacer &operator=(const LotFramePacer &) = delete;
+
+            // 메인 스레드 전용. publishedFrame은 마지막으로 발행한 스냅샷의 프레임 번호
+            // 렌더 스레드가 프레임을 건너뛰어도 멈추지 않도록 최대 MAX_SLOT_WAIT까지만 기다림
+            void waitForFrameSlot(uint64_t publishedFrame, const std::atomic<bool> &running);
+
+            // 렌더 스레드 전용
+            void framePresented(uint64_t frameNumber, Clock::time_point inputTime);
+
+            const LotFramePacerConfig &getConfig() const { return config; }
+            // 지금까지 프레젠트한 프레임의 평균 입력 지연 (ms)
+            double getAverageLatencyMs() const;
+
+        private:
+            static constexpr auto MAX_SLOT_WAIT = std::chrono::milliseconds(100);
+
+            LotFramePacerConfig config;
+            Clock::time_point lastFrameStart{};
+
+            std::atomic<uint64_t> presentedFrame{0};
+            std::atomic<uint64_t> latencySamples{0};
+            std::atomic<double> latencySumMs{0.0};
+            LotHistogram &latencyMs;
+    };
+} // namespace lot
@@ -0,0 +1,364 @@
+#include "lot_gpu_profiler.h"
+#include "lot_frame_arena.h"
+
+// std
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+
+namespace lot {
+    const char *const LotGpuProfiler::PIPELINE_STATISTIC_NAMES[PIPELINE_STATISTIC_COUNT] = {
+        "inputAssemblyVertices",
+        "inputAssemblyPrimitives",
+        "vertexShaderInvocations",
+        "clippingInvocations",
+        "clippingPrimitives",
+        "fragmentShaderInvocations",
+    };
+
+    LotGpuProfiler::LotGpuProfiler(LotDevice &device, uint32_t frameCount, uint32_t maxScopes, size_t historySize)
+    : lotDevice{device}, maxScopes{maxScopes}, historySize{historySize}, frames(frameCount) {
+        history.reserve(historySize);
+        uint32_t validBits = lotDevice.timestampValidBits();
+        timestampsSupported = validBits > 0 && lotDevice.properties.limits.timestampPeriod > 0.f;
+        if (!timestampsSupported) {
+            return;
+        }
+        timestampMask = validBits >= 64 ? ~0ull : ((1ull << validBits) - 1);
+        timestampPeriodNs = static_cast<double>(lotDevice.properties.limits.timestampPeriod);
+        statisticsSupported = lotDevice.supportsPipelineStatistics();
+
+        commandPool = lotDevice.createGraphicsCommandPool(VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+        for (auto &frame : frames) {
+            createQueryPools(frame);
+        }
+    }
+
+    LotGpuProfiler::~LotGpuProfiler() {
+        {
+            std::lock_guard<std::mutex> lock{lotDevice.queueMutex()};
+            vkDeviceWaitIdle(lotDevice.device());
+        }
+        for (auto &frame : frames) {
+            if (frame.timestampPool != VK_NULL_HANDLE) {
+                vkDestroyQueryPool(lotDevice.device(), frame.timestampPool, nullptr);
+            }
+            if (frame.statisticsPool != VK_NULL_HANDLE) {
+                vkDestroyQueryPool(lotDevice.device(), frame.statisticsPool, nullptr);
+            }
+        }
+        if (commandPool != VK_NULL_HANDLE) {
+            // 풀을 파괴하면 할당된 보조 커맨드 버퍼도 함께 해제됨
+            vkDestroyCommandPool(lotDevice.device(), commandPool, nullptr);
+        }
+    }
+
+    VkQueryPipelineStatisticFlags LotGpuProfiler::inheritedPipelineStatistics(const LotDevice &device) {
+        return device.supportsPipelineStatistics() ? PIPELINE_STATISTICS : 0;
+    }
+
+    void LotGpuProfiler::createQueryPools(FrameQueries &frame) {
+        VkQueryPoolCreateInfo timestampInfo{};
+        timestampInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        timestampInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        timestampInfo.queryCount = maxScopes * 2;
+        if (vkCreateQueryPool(lotDevice.device(), &timestampInfo, nullptr, &frame.timestampPool) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create timestamp query pool!");
+        }
+
+        frame.timestampCommandBuffers.assign(maxScopes * 2, VK_NULL_HANDLE);
+        frame.timestampRecorded.assign(maxScopes * 2, 0);
+        frame.scopes.reserve(maxScopes);
+
+        if (!statisticsSupported) {
+            return;
+        }
+        VkQueryPoolCreateInfo statisticsInfo{};
+        statisticsInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        statisticsInfo.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+        statisticsInfo.queryCount = 1;
+        statisticsInfo.pipelineStatistics = PIPELINE_STATISTICS;
+        if (vkCreateQueryPool(lotDevice.device(), &statisticsInfo, nullptr, &frame.statisticsPool) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create pipeline statistics query pool!");
+        }
+    }
+
+    void LotGpuProfiler::beginFrame(VkCommandBuffer commandBuffer, int frameIndex, uint64_t frameNumber,
+                                    VkRenderPass renderPass) {
+        if (!timestampsSupported) {
+            return;
+        }
+
+        FrameQueries &frame = frames[frameIndex];
+        // 이 슬롯의 펜스는 이미 신호되었으므로 결과를 기다리지 않고 읽을 수 있음
+        if (frame.pending) {
+            collectResults(frame);
+        }
+
+        if (frame.recordedRenderPass != renderPass) {
+            // 스왑체인 재생성으로 렌더 패스가 바뀌면 상속 정보가 달라지므로 다시 기록
+            std::fill(frame.timestampRecorded.begin(), frame.timestampRecorded.end(), 0);
+            frame.recordedRenderPass = renderPass;
+        }
+
+        vkCmdResetQueryPool(commandBuffer, frame.timestampPool, 0, maxScopes * 2);
+        frame.scopes.clear();
+        frame.frameNumber = frameNumber;
+        frame.pending = true;
+        frame.statisticsActive = false;
+        currentFrame = &frame;
+        currentDepth = 0;
+
+        if (statisticsSupported) {
+            vkCmdResetQueryPool(commandBuffer, frame.statisticsPool, 0, 1);
+            vkCmdBeginQuery(commandBuffer, frame.statisticsPool, 0, 0);
+            frame.statisticsActive = true;
+        }
+    }
+
+    void LotGpuProfiler::endFrame(VkCommandBuffer commandBuffer) {
+        if (currentFrame == nullptr) {
+            return;
+        }
+        if (currentFrame->statisticsActive) {
+            vkCmdEndQuery(commandBuffer, currentFrame->statisticsPool, 0);
+        }
+        currentFrame = nullptr;
+    }
+
+    uint32_t LotGpuProfiler::beginScope(VkCommandBuffer commandBuffer, const char *name, VkSubpassContents contents) {
+        if (currentFrame == nullptr || currentFrame->scopes.size() >= maxScopes) {
+            return INVALID_SCOPE;
+        }
+
+        uint32_t scope = static_cast<uint32_t>(currentFrame->scopes.size());
+        currentFrame->scopes.push_back({name, currentDepth, false});
+        currentDepth++;
+        writeTimestamp(commandBuffer, scope * 2, contents);
+        return scope;
+    }
+
+    void LotGpuProfiler::endScope(VkCommandBuffer commandBuffer, uint32_t scope, VkSubpassContents contents) {
+        if (currentFrame == nullptr || scope >= currentFrame->scopes.size()) {
+            return;
+        }
+
+        currentFrame->scopes[scope].ended = true;
+        currentDepth--;
+        writeTimestamp(commandBuffer, scope * 2 + 1, contents);
+    }
+
+    void LotGpuProfiler::collectPendingResults() {
+        // 제출 순서대로 기록에 남도록 프레임 번호 순으로 회수
+        std::vector<FrameQueries *> pendingFrames;
+        for (auto &frame : frames) {
+            if (frame.pending && &frame != currentFrame) {
+                pendingFrames.push_back(&frame);
+            }
+        }
+        std::sort(pendingFrames.begin(), pendingFrames.end(),
+                  [](const FrameQueries *a, const FrameQueries *b) { return a->frameNumber < b->frameNumber; });
+        for (FrameQueries *frame : pendingFrames) {
+            collectResults(*frame);
+        }
+    }
+
+    void LotGpuProfiler::writeTimestamp(VkCommandBuffer commandBuffer, uint32_t query, VkSubpassContents contents) {
+        if (contents == VK_SUBPASS_CONTENTS_INLINE) {
+            VkPipelineStageFlagBits stage = (query % 2 == 0) ?
+                VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+            vkCmdWriteTimestamp(commandBuffer, stage, currentFrame->timestampPool, query);
+            return;
+        }
+
+        // 보조 커맨드 버퍼 전용 서브패스에서는 주 커맨드 버퍼가 vkCmdExecuteCommands만 호출할 수 있음
+        VkCommandBuffer timestampCommandBuffer = getTimestampCommandBuffer(*currentFrame, query);
+        vkCmdExecuteCommands(commandBuffer, 1, &timestampCommandBuffer);
+    }
+
+    VkCommandBuffer LotGpuProfiler::getTimestampCommandBuffer(FrameQueries &frame, uint32_t query) {
+        VkCommandBuffer &commandBuffer = frame.timestampCommandBuffers[query];
+        if (frame.timestampRecorded[query]) {
+            return commandBuffer;
+        }
+
+        if (commandBuffer == VK_NULL_HANDLE) {
+            VkCommandBufferAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocInfo.commandPool = commandPool;
+            allocInfo.commandBufferCount = 1;
+            if (vkAllocateCommandBuffers(lotDevice.device(), &allocInfo, &commandBuffer) != VK_SUCCESS) {
+                throw std::runtime_error("failed to allocate timestamp command buffer!");
+            }
+        }
+
+        // 프레임버퍼를 지정하지 않으므로 같은 슬롯에서 매 프레임 재사용 가능 (쿼리 리셋은 주 커맨드 버퍼에서)
+        VkCommandBufferInheritanceInfo inheritanceInfo{};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = frame.recordedRenderPass;
+        inheritanceInfo.subpass = 0;
+        inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+        inheritanceInfo.pipelineStatistics = inheritedPipelineStatistics(lotDevice);
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+            throw std::runtime_error("failed to begin recording timestamp command buffer!");
+        }
+        VkPipelineStageFlagBits stage = (query % 2 == 0) ?
+            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+        vkCmdWriteTimestamp(commandBuffer, stage, frame.timestampPool, query);
+        if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to record timestamp command buffer!");
+        }
+
+        frame.timestampRecorded[query] = 1;
+        return commandBuffer;
+    }
+
+    void LotGpuProfiler::collectResults(FrameQueries &frame) {
+        frame.pending = false;
+        uint32_t queryCount = static_cast<uint32_t>(frame.scopes.size()) * 2;
+        if (queryCount == 0) {
+            return;
+        }
+
+        // WAIT 플래그 없이 읽으므로 아직 준비되지 않았다면 (VK_NOT_READY) 이 프레임은 버림
+        LotScratchScope scratch;
+        std::pmr::vector<uint64_t> timestamps(queryCount, scratch.resource());
+        VkResult result = vkGetQueryPoolResults(
+            lotDevice.device(), frame.timestampPool, 0, queryCount,
+            timestamps.size() * sizeof(uint64_t), timestamps.data(), sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT);
+        if (result != VK_SUCCESS || historySize == 0) {
+            return;
+        }
+
+        std::array<uint64_t, PIPELINE_STATISTIC_COUNT> statistics{};
+        bool hasStatistics = false;
+        if (frame.statisticsActive) {
+            result = vkGetQueryPoolResults(
+                lotDevice.device(), frame.statisticsPool, 0, 1,
+                sizeof(statistics), statistics.data(),
+                sizeof(statistics), VK_QUERY_RESULT_64_BIT);
+            hasStatistics = (result == VK_SUCCESS);
+        }
+
+        // 기록이 가득 차면 가장 오래된 항목을 덮어씀 (정상 상태에서는 힙 할당 없음)
+        std::lock_guard<std::mutex> lock{historyMutex};
+        FrameResult *frameResult;
+        if (history.size() < historySize) {
+            frameResult = &history.emplace_back();
+        } else {
+            frameResult = &history[historyStart];
+            historyStart = (historyStart + 1) % historySize;
+        }
+        frameResult->frameNumber = frame.frameNumber;
+        frameResult->scopes.clear();
+        for (size_t i = 0; i < frame.scopes.size(); i++) {
+            const ScopeRecord &scope = frame.scopes[i];
+            if (!scope.ended) continue;
+
+            // 유효 비트 밖은 버리고 래핑을 고려해 차이를 계산
+            uint64_t ticks = (timestamps[i * 2 + 1] - timestamps[i * 2]) & timestampMask;
+            double milliseconds = static_cast<double>(ticks) * timestampPeriodNs / 1.0e6;
+            frameResult->scopes.push_back({scope.name, scope.depth, milliseconds});
+        }
+        frameResult->hasStatistics = hasStatistics;
+        frameResult->statistics = statistics;
+    }
+
+    std::vector<LotGpuProfiler::FrameResult> LotGpuProfiler::getHistory() const {
+        std::lock_guard<std::mutex> lock{historyMutex};
+        // 오래된 프레임부터
+        std::vector<FrameResult> ordered;
+        ordered.reserve(history.size());
+        for (size_t i = 0; i < history.size(); i++) {
+            ordered.push_back(history[(historyStart + i) % history.size()]);
+        }
+        return ordered;
+    }
+
+    double LotGpuProfiler::getAverageMilliseconds(const char *name) const {
+        std::lock_guard<std::mutex> lock{historyMutex};
+        double sum = 0.0;
+        size_t count = 0;
+        for (const auto &frame : history) {
+            for (const auto &scope : frame.scopes) {
+                if (std::strcmp(scope.name, name) == 0) {
+                    sum += scope.milliseconds;
+                    count++;
+                }
+            }
+        }
+        return count > 0 ? sum / static_cast<double>(count) : 0.0;
+    }
+
+    void LotGpuProfiler::writeCsv(const std::string &filepath) const {
+        std::ofstream file{filepath, std::ios::trunc};
+        if (!file.is_open()) {
+            throw std::runtime_error("failed to open file: " + filepath);
+        }
+
+        // 구간은 value가 밀리초, 통계는 value가 개수
+        file << "frame,type,name,depth,value\n";
+        for (const auto &frame : getHistory()) {
+            for (const auto &scope : frame.scopes) {
+                file << frame.frameNumber << ",scope," << scope.name << ","
+                     << scope.depth << "," << scope.milliseconds << "\n";
+            }
+            if (!frame.hasStatistics) continue;
+            for (uint32_t i = 0; i < PIPELINE_STATISTIC_COUNT; i++) {
+                file << frame.frameNumber << ",statistic," << PIPELINE_STATISTIC_NAMES[i] << ",,"
+                     << frame.statistics[i] << "\n";
+            }
+        }
+    }
+
+    void LotGpuProfiler::writeJson(const std::string &filepath) const {
+        std::ofstream file{filepath, std::ios::trunc};
+        if (!file.is_open()) {
+            throw std::runtime_error("failed to open file: " + filepath);
+        }
+
+        auto history = getHistory();
+        file << "{\n  \"timestampPeriodNs\": " << timestampPeriodNs << ",\n  \"frames\": [";
+        for (size_t f = 0; f < history.size(); f++) {
+            const auto &frame = history[f];
+            file << (f == 0 ? "\n" : ",\n") << "    {\"frame\": " << frame.frameNumber << ", \"scopes\": [";
+            for (size_t i = 0; i < frame.scopes.size(); i++) {
+                const auto &scope = frame.scopes[i];
+                file << (i == 0 ? "" : ", ") << "{\"name\": \"" << scope.name << "\", \"depth\": " << scope.depth
+                     << ", \"ms\": " << scope.milliseconds << "}";
+            }
+            file << "]";
+            if (frame.hasStatistics) {
+                file << ", \"statistics\": {";
+                for (uint32_t i = 0; i < PIPELINE_STATISTIC_COUNT; i++) {
+                    file << (i == 0 ? "" : ", ") << "\"" << PIPELINE_STATISTIC_NAMES[i] << "\": "
+                         << frame.statistics[i];
+                }
+                file << "}";
+            }
+            file << "}";
+        }
+        file << "\n  ]\n}\n";
+    }
+
+    void LotGpuProfiler::dump(const std::string &filepath) const {
+        const std::string extension = ".json";
+        bool isJson = filepath.size() >= extension.size() &&
+                      filepath.compare(filepath.size() - extension.size(), extension.size(), extension) == 0;
+        if (isJson) {
+            writeJson(filepath);
+        } else {
+            writeCsv(filepath);
+        }
+    }
+} // namespace lot
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "lot_device.h"
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lot {
+    // 타임스탬프/파이프라인 통계 쿼리 기반 GPU 프로파일러
+    // - 프레임 슬롯마다 쿼리 풀을 두고, 슬롯의 펜스를 기다린 뒤 beginFrame에서 대기 없이 이전 결과를 읽음
+    // - 렌더 패스 밖의 구간은 주 커맨드 버퍼에 직접 기록하고, 보조 커맨드 버퍼 전용 서브패스 안의 구간은
+    //   타임스탬프 하나만 담은 보조 커맨드 버퍼를 실행해서 기록
+    // - 파이프라인 통계는 프레임 전체에 대해 하나 (pipelineStatisticsQuery + inheritedQueries 지원 시)
+    class LotGpuProfiler {
+        public:
+            static constexpr uint32_t INVALID_SCOPE = UINT32_MAX;
+            static constexpr uint32_t PIPELINE_STATISTIC_COUNT = 6;
+            // 결과는 비트 순서대로 기록됨 (PIPELINE_STATISTIC_NAMES와 같은 순서)
+            static constexpr VkQueryPipelineStatisticFlags PIPELINE_STATISTICS =
+                VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT |
+                VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+                VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+                VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT |
+                VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+                VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+            static const char *const PIPELINE_STATISTIC_NAMES[PIPELINE_STATISTIC_COUNT];
+
+            struct ScopeTiming {
+                const char *name = nullptr;
+                uint32_t depth = 0;
+                double milliseconds = 0.0;
+            };
+
+            struct FrameResult {
+                uint64_t frameNumber = 0;
+                std::vector<ScopeTiming> scopes;
+                bool hasStatistics = false;
+                std::array<uint64_t, PIPELINE_STATISTIC_COUNT> statistics{};
+            };
+
+            LotGpuProfiler(LotDevice &device, uint32_t frameCount, uint32_t maxScopes = 32, size_t historySize = 240);
+            ~LotGpuProfiler();
+
+            LotGpuProfiler(const LotGpuProfiler &) = delete;
+            LotGpuProfiler &operator=(const LotGpuProfiler &) = delete;
+
+            // 그래픽스 큐가 타임스탬프를 지원하지 않으면 모든 기록 함수가 아무것도 하지 않음
+            bool isEnabled() const { return timestampsSupported; }
+            bool hasPipelineStatistics() const { return statisticsSupported; }
+
+            // 통계 쿼리가 켜진 구간 안에서 실행되는 보조 커맨드 버퍼의 상속 정보에 지정할 플래그
+            static VkQueryPipelineStatisticFlags inheritedPipelineStatistics(const LotDevice &device);
+
+            // 렌더 스레드 전용
+            // beginFrame은 이 프레임 슬롯의 펜스를 기다린 뒤 렌더 패스 밖에서 호출
+            void beginFrame(VkCommandBuffer commandBuffer, int frameIndex, uint64_t frameNumber,
+                            VkRenderPass renderPass);
+            void endFrame(VkCommandBuffer commandBuffer);
+            // name은 정적 문자열이어야 함 (결과에는 포인터만 저장)
+            // 보조 커맨드 버퍼 전용 서브패스 안에서는 contents로 VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS 지정
+            uint32_t beginScope(VkCommandBuffer commandBuffer, const char *name,
+                                VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
+            void endScope(VkCommandBuffer commandBuffer, uint32_t scope,
+                          VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
+            // 디바이스 대기 후 호출: 아직 회수하지 않은 프레임 슬롯의 결과를 읽음 (종료 직전 덤프용)
+            void collectPendingResults();
+
+            // 아래는 어느 스레드에서나 호출 가능
+            std::vector<FrameResult> getHistory() const;
+            // 기록에 남은 프레임들에서 name 구간의 평균 (없으면 0)
+            double getAverageMilliseconds(const char *name) const;
+            void writeCsv(const std::string &filepath) const;
+            void writeJson(const std::string &filepath) const;
+            // 확장자가 .json이면 JSON, 아니면 CSV
+            void dump(const std::string &filepath) const;
+
+        private:
+            struct ScopeRecord {
+                const char *name = nullptr;
+                uint32_t depth = 0;
+                bool ended = false;
+            };
+
+            struct FrameQueries {
+                VkQueryPool timestampPool = VK_NULL_HANDLE;
+                VkQueryPool statisticsPool = VK_NULL_HANDLE;
+                // 쿼리마다 해당 타임스탬프 하나만 기록한 보조 커맨드 버퍼 (렌더 패스가 바뀌면 다시 기록)
+                std::vector<VkCommandBuffer> timestampCommandBuffers;
+                std::vector<uint8_t> timestampRecorded;
+                VkRenderPass recordedRenderPass = VK_NULL_HANDLE;
+
+                // 구간 i는 타임스탬프 쿼리 2i(시작), 2i+1(끝)을 사용
+                std::vector<ScopeRecord> scopes;
+                uint64_t frameNumber = 0;
+                bool pending = false;
+                bool statisticsActive = false;
+            };
+
+            void createQueryPools(FrameQueries &frame);
+            void collectResults(FrameQueries &frame);
+            void writeTimestamp(VkCommandBuffer commandBuffer, uint32_t query, VkSubpassContents contents);
+            VkCommandBuffer getTimestampCommandBuffer(FrameQueries &frame, uint32_t query);
+
+            LotDevice &lotDevice;
+            uint32_t maxScopes;
+            size_t historySize;
+            bool timestampsSupported = false;
+            bool statisticsSupported = false;
+            uint64_t timestampMask = ~0ull;
+            double timestampPeriodNs = 1.0;
+
+            // 타임스탬프용 보조 커맨드 버퍼 할당 (렌더 스레드 전용)
+            VkCommandPool commandPool = VK_NULL_HANDLE;
+            std::vector<FrameQueries> frames;
+            FrameQueries *currentFrame = nullptr;
+            uint32_t currentDepth = 0;
+
+            mutable std::mutex historyMutex;
+            // historySize개짜리 링 (가득 차면 historyStart가 가장 오래된 항목, 덮어쓸 때 scopes 용량을 재사용)
+            std::vector<FrameResult> history;
+            size_t historyStart = 0;
+    };
+} // namespace lot
@@ -0,0 +1,359 @@
+#include "lot_input.h"
+#include "lot_log.h"
+
+// std
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace lot {
+    LotInput *LotInput::instance = nullptr;
+
+    LotInput::LotInput(GLFWwindow *window, Mode mode, const std::string &path, float replayTimestep)
+    : window{window}, mode{mode}, replayTimestep{replayTimestep} {
+        bindDefaultActions();
+
+        if (mode == Mode::Replay) {
+            if (replayTimestep <= 0.f) {
+                throw std::runtime_error("input replay timestep must be greater than zero");
+            }
+            loadRecording(path);
+            LOT_LOG_INFO("[Input] Replaying {} events ({} s) from {} at {} s per frame",
+                         replayEvents.size(), endTime, path, replayTimestep);
+            return;
+        }
+
+        if (mode == Mode::Record) {
+            recordFile.open(path, std::ios::trunc);
+            if (!recordFile.is_open()) {
+                throw std::runtime_error("failed to open file: " + path);
+            }
+            recordFile << std::setprecision(17);
+            LOT_LOG_INFO("[Input] Recording input to {}", path);
+        }
+        registerCallbacks();
+    }
+
+    LotInput::~LotInput() {
+        if (instance == this) {
+            unregisterCallbacks();
+        }
+        if (recordFile.is_open()) {
+            recordFile << time << " end\n";
+        }
+    }
+
+    void LotInput::registerCallbacks() {
+        instance = this;
+        glfwSetKeyCallback(window, keyCallback);
+        glfwSetMouseButtonCallback(window, mouseButtonCallback);
+        glfwSetCursorPosCallback(window, cursorPosCallback);
+        glfwSetScrollCallback(window, scrollCallback);
+        glfwSetWindowSizeCallback(window, windowSizeCallback);
+    }
+
+    void LotInput::unregisterCallbacks() {
+        glfwSetKeyCallback(window, nullptr);
+        glfwSetMouseButtonCallback(window, nullptr);
+        glfwSetCursorPosCallback(window, nullptr);
+        glfwSetScrollCallback(window, nullptr);
+        glfwSetWindowSizeCallback(window, nullptr);
+        instance = nullptr;
+    }
+
+    void LotInput::keyCallback(GLFWwindow *window, int key, int scancode, int action, int mods) {
+        if (instance && isValidKey(key)) {
+            instance->queueButtonEvent(LotInputEvent::Type::Key, key, action);
+        }
+    }
+
+    void LotInput::mouseButtonCallback(GLFWwindow *window, int button, int action, int mods) {
+        if (instance && isValidButton(button)) {
+            instance->queueButtonEvent(LotInputEvent::Type::MouseButton, button, action);
+        }
+    }
+
+    void LotInput::cursorPosCallback(GLFWwindow *window, double x, double y) {
+        if (instance) {
+            instance->hasPendingCursor = true;
+            instance->pendingCursorX = x;
+            instance->pendingCursorY = y;
+        }
+    }
+
+    void LotInput::scrollCallback(GLFWwindow *window, double xoffset, double yoffset) {
+        if (instance) {
+            instance->pendingScroll += yoffset;
+        }
+    }
+
+    void LotInput::windowSizeCallback(GLFWwindow *window, int width, int height) {
+        if (instance) {
+            instance->hasPendingWindowSize = true;
+            instance->pendingWindowWidth = width;
+            instance->pendingWindowHeight = height;
+        }
+    }
+
+    void LotInput::queueButtonEvent(LotInputEvent::Type type, int code, int action) {
+        // 키 반복(GLFW_REPEAT)은 상태가 바뀌지 않으므로 무시
+        if (action == GLFW_REPEAT) {
+            return;
+        }
+        LotInputEvent event{glfwGetTime(), type, code, action == GLFW_PRESS};
+        pendingButtonEvents.push_back(event);
+    }
+
+    float LotInput::beginFrame(float wallFrameTime) {
+        frameNumber++;
+        scrollDelta = 0.0;
+        windowResized = false;
+        keys.pressed.reset();
+        keys.released.reset();
+        buttons.pressed.reset();
+        buttons.released.reset();
+
+        if (mode == Mode::Replay) {
+            time = static_cast<double>(frameNumber - 1) * replayTimestep;
+            while (replayPosition < replayEvents.size() && replayEvents[replayPosition].time <= time) {
+                applyEvent(replayEvents[replayPosition++]);
+            }
+            return replayTimestep;
+        }
+
+        // 첫 프레임을 0초로 기록해 재생 첫 프레임과 맞춤
+        if (frameNumber == 1) {
+            startTime = glfwGetTime();
+            // 콜백은 바뀔 때만 오므로 시작 상태는 직접 읽음
+            hasPendingCursor = true;
+            glfwGetCursorPos(window, &pendingCursorX, &pendingCursorY);
+            hasPendingWindowSize = true;
+            glfwGetWindowSize(window, &pendingWindowWidth, &pendingWindowHeight);
+        }
+        time = glfwGetTime() - startTime;
+        flushPendingEvents();
+        return wallFrameTime;
+    }
+
+    void LotInput::flushPendingEvents() {
+        for (auto &event : pendingButtonEvents) {
+            event.time = std::clamp(event.time - startTime, 0.0, time);
+            applyEvent(event);
+            record(event);
+        }
+        pendingButtonEvents.clear();
+
+        if (hasPendingCursor && (pendingCursorX != cursorX || pendingCursorY != cursorY || frameNumber == 1)) {
+            LotInputEvent event{time, LotInputEvent::Type::Cursor};
+            event.x = pendingCursorX;
+            event.y = pendingCursorY;
+            applyEvent(event);
+            record(event);
+        }
+        hasPendingCursor = false;
+
+        if (hasPendingWindowSize &&
+            (pendingWindowWidth != windowWidth || pendingWindowHeight != windowHeight || frameNumber == 1)) {
+            LotInputEvent event{time, LotInputEvent::Type::WindowSize};
+            event.x = pendingWindowWidth;
+            event.y = pendingWindowHeight;
+            applyEvent(event);
+            record(event);
+        }
+        hasPendingWindowSize = false;
+
+        if (pendingScroll != 0.0) {
+            LotInputEvent event{time, LotInputEvent::Type::Scroll};
+            event.y = pendingScroll;
+            pendingScroll = 0.0;
+            applyEvent(event);
+            record(event);
+        }
+    }
+
+    void LotInput::bindAction(LotInputAction action, LotInputBinding binding) {
+        auto &bindings = actionBindings[static_cast<size_t>(action)];
+        for (auto &slot : bindings) {
+            if (slot.device == LotInputBinding::Device::None) {
+                slot = binding;
+                return;
+            }
+        }
+        throw std::runtime_error("too many input bindings for action " + std::to_string(static_cast<int>(action)));
+    }
+
+    void LotInput::clearActionBindings(LotInputAction action) {
+        actionBindings[static_cast<size_t>(action)] = {};
+    }
+
+    void LotInput::bindDefaultActions() {
+        using Action = LotInputAction;
+        auto key = [](int code) { return LotInputBinding{LotInputBinding::Device::Key, code}; };
+        auto button = [](int code) { return LotInputBinding{LotInputBinding::Device::MouseButton, code}; };
+
+        actionBindings = {};
+        bindAction(Action::MoveLeft, key(GLFW_KEY_A));
+        bindAction(Action::MoveRight, key(GLFW_KEY_D));
+        bindAction(Action::MoveForward, key(GLFW_KEY_W));
+        bindAction(Action::MoveBackward, key(GLFW_KEY_S));
+        bindAction(Action::MoveUp, key(GLFW_KEY_Q));
+        bindAction(Action::MoveDown, key(GLFW_KEY_E));
+
+        bindAction(Action::LookLeft, key(GLFW_KEY_LEFT));
+        bindAction(Action::LookRight, key(GLFW_KEY_RIGHT));
+        bindAction(Action::LookUp, key(GLFW_KEY_UP));
+        bindAction(Action::LookDown, key(GLFW_KEY_DOWN));
+
+        bindAction(Action::ObjectRotateLeft, key(GLFW_KEY_KP_4));
+        bindAction(Action::ObjectRotateRight, key(GLFW_KEY_KP_6));
+        bindAction(Action::ObjectRotateUp, key(GLFW_KEY_KP_8));
+        bindAction(Action::ObjectRotateDown, key(GLFW_KEY_KP_2));
+        bindAction(Action::ObjectRollLeft, key(GLFW_KEY_KP_7));
+        bindAction(Action::ObjectRollRight, key(GLFW_KEY_KP_9));
+
+        bindAction(Action::SelectNextObject, key(GLFW_KEY_KP_ADD));
+        bindAction(Action::SelectPrevObject, key(GLFW_KEY_KP_SUBTRACT));
+        bindAction(Action::IncreaseRotationSpeed, key(GLFW_KEY_KP_MULTIPLY));
+        bindAction(Action::DecreaseRotationSpeed, key(GLFW_KEY_KP_DIVIDE));
+
+        bindAction(Action::ClearSelection, key(GLFW_KEY_ESCAPE));
+        bindAction(Action::AddCube, key(GLFW_KEY_N));
+        bindAction(Action::DeleteSelected, key(GLFW_KEY_DELETE));
+
+        bindAction(Action::PickObject, button(GLFW_MOUSE_BUTTON_LEFT));
+        bindAction(Action::ToggleSelectionModifier, key(GLFW_KEY_LEFT_CONTROL));
+        bindAction(Action::ToggleSelectionModifier, key(GLFW_KEY_RIGHT_CONTROL));
+        bindAction(Action::OrbitCamera, button(GLFW_MOUSE_BUTTON_RIGHT));
+        bindAction(Action::PanCamera, button(GLFW_MOUSE_BUTTON_MIDDLE));
+    }
+
+    template <typename Predicate>
+    bool LotInput::anyBinding(LotInputAction action, Predicate predicate) const {
+        for (const auto &binding : actionBindings[static_cast<size_t>(action)]) {
+            if (binding.device != LotInputBinding::Device::None && predicate(binding)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool LotInput::isActionDown(LotInputAction action) const {
+        return anyBinding(action, [this](const LotInputBinding &binding) {
+            return binding.device == LotInputBinding::Device::Key ? isKeyDown(binding.code)
+                                                                  : isMouseButtonDown(binding.code);
+        });
+    }
+
+    bool LotInput::isActionPressed(LotInputAction action) const {
+        return anyBinding(action, [this](const LotInputBinding &binding) {
+            return binding.device == LotInputBinding::Device::Key ? isKeyPressed(binding.code)
+                                                                  : isMouseButtonPressed(binding.code);
+        });
+    }
+
+    bool LotInput::isActionReleased(LotInputAction action) const {
+        return anyBinding(action, [this](const LotInputBinding &binding) {
+            return binding.device == LotInputBinding::Device::Key ? isKeyReleased(binding.code)
+                                                                  : isMouseButtonReleased(binding.code);
+        });
+    }
+
+    void LotInput::applyEvent(const LotInputEvent &event) {
+        switch (event.type) {
+            case LotInputEvent::Type::Key:
+                if (isValidKey(event.code)) {
+                    keys.apply(event.code, event.pressed);
+                }
+                break;
+            case LotInputEvent::Type::MouseButton:
+                if (isValidButton(event.code)) {
+                    buttons.apply(event.code, event.pressed);
+                }
+                break;
+            case LotInputEvent::Type::Cursor:
+                cursorX = event.x;
+                cursorY = event.y;
+                break;
+            case LotInputEvent::Type::Scroll:
+                scrollDelta += event.y;
+                break;
+            case LotInputEvent::Type::WindowSize:
+                windowWidth = static_cast<int>(event.x);
+                windowHeight = static_cast<int>(event.y);
+                windowResized = true;
+                break;
+        }
+    }
+
+    void LotInput::record(const LotInputEvent &event) {
+        if (!recordFile.is_open()) {
+            return;
+        }
+        recordFile << event.time << ' ';
+        switch (event.type) {
+            case LotInputEvent::Type::Key:
+                recordFile << "k " << event.code << ' ' << (event.pressed ? 1 : 0);
+                break;
+            case LotInputEvent::Type::MouseButton:
+                recordFile << "b " << event.code << ' ' << (event.pressed ? 1 : 0);
+                break;
+            case LotInputEvent::Type::Cursor:
+                recordFile << "c " << event.x << ' ' << event.y;
+                break;
+            case LotInputEvent::Type::Scroll:
+                recordFile << "s " << event.x << ' ' << event.y;
+                break;
+            case LotInputEvent::Type::WindowSize:
+                recordFile << "w " << event.x << ' ' << event.y;
+                break;
+        }
+        recordFile << '\n';
+    }
+
+    void LotInput::loadRecording(const std::string &path) {
+        std::ifstream file{path};
+        if (!file.is_open()) {
+            throw std::runtime_error("failed to open file: " + path);
+        }
+
+        bool hasEnd = false;
+        std::string line;
+        for (size_t lineNumber = 1; std::getline(file, line); lineNumber++) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream stream{line};
+            LotInputEvent event{};
+            std::string type;
+            stream >> event.time >> type;
+
+            int pressed = 0;
+            if (type == "k" || type == "b") {
+                event.type = type == "k" ? LotInputEvent::Type::Key : LotInputEvent::Type::MouseButton;
+                stream >> event.code >> pressed;
+                event.pressed = pressed != 0;
+            } else if (type == "c" || type == "s" || type == "w") {
+                event.type = type == "c" ? LotInputEvent::Type::Cursor
+                           : type == "s" ? LotInputEvent::Type::Scroll
+                                         : LotInputEvent::Type::WindowSize;
+                stream >> event.x >> event.y;
+            } else if (type == "end") {
+                endTime = event.time;
+                hasEnd = true;
+                continue;
+            } else {
+                stream.setstate(std::ios::failbit);
+            }
+
+            if (stream.fail() || (!replayEvents.empty() && event.time < replayEvents.back().time)) {
+                throw std::runtime_error("invalid input recording " + path + " at line " + std::to_string(lineNumber));
+            }
+            replayEvents.push_back(event);
+        }
+
+        if (!hasEnd && !replayEvents.empty()) {
+            endTime = replayEvents.back().time;
+        }
+    }
+} // namespace lot
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "lot_window.h"
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace lot {
+    struct LotInputEvent {
+        enum class Type : uint8_t { Key, MouseButton, Cursor, Scroll, WindowSize };
+
+        // 기록 시작 기준 시간 (초)
+        double time = 0.0;
+        Type type = Type::Key;
+        // 키/마우스 버튼 번호
+        int code = 0;
+        bool pressed = false;
+        // 커서 위치, 스크롤 양, 창 크기
+        double x = 0.0;
+        double y = 0.0;
+    };
+
+    // 게임 쪽 코드가 조회하는 입력 액션 (물리 키/버튼은 LotInput 바인딩으로 연결)
+    enum class LotInputAction : uint8_t {
+        // 카메라 이동/회전
+        MoveLeft, MoveRight, MoveForward, MoveBackward, MoveUp, MoveDown,
+        LookLeft, LookRight, LookUp, LookDown,
+        // 객체 회전 (넘패드)
+        ObjectRotateLeft, ObjectRotateRight, ObjectRotateUp, ObjectRotateDown, ObjectRollLeft, ObjectRollRight,
+        // 객체 선택 / 회전 속도
+        SelectNextObject, SelectPrevObject, IncreaseRotationSpeed, DecreaseRotationSpeed,
+        // 단축키
+        ClearSelection, AddCube, DeleteSelected,
+        // 마우스
+        PickObject, ToggleSelectionModifier, OrbitCamera, PanCamera,
+        Count
+    };
+
+    struct LotInputBinding {
+        enum class Device : uint8_t { None, Key, MouseButton };
+
+        Device device = Device::None;
+        int code = 0;
+    };
+
+    // 입력 상태 계층 (카메라/선택/단축키는 GLFW 대신 이 객체에서 입력을 읽음)
+    // - GLFW 키/버튼/커서/스크롤/창 크기 콜백이 이벤트를 쌓고, beginFrame에서 비트셋 상태에 반영
+    //   (프레임 비용은 바뀐 입력 수에 비례하고, 두 프레임 사이의 짧은 입력도 pressed/released 에지로 남음)
+    // - Live: 창에서 입력을 받음
+    // - Record: Live와 같고, 바뀐 입력을 타임스탬프와 함께 파일에 기록
+    // - Replay: 기록 파일의 이벤트를 고정 시간 간격 프레임에 적용 (창 입력과 실제 경과 시간은 무시)
+    //   같은 기록을 재생하면 빌드/머신과 무관하게 같은 카메라/객체 움직임이 재현됨
+    // 기록 형식: 한 줄에 이벤트 하나 "<시간> <k|b|c|s|w> <값...>", 마지막 줄은 "<시간> end"
+    class LotInput {
+        public:
+            enum class Mode { Live, Record, Replay };
+
+            static constexpr float DEFAULT_REPLAY_TIMESTEP = 1.f / 60.f;
+            // 액션 하나에 연결할 수 있는 최대 키/버튼 수
+            static constexpr size_t MAX_ACTION_BINDINGS = 2;
+
+            // Record/Replay에서는 path가 기록 파일 (열 수 없거나 형식이 틀리면 예외)
+            LotInput(GLFWwindow *window, Mode mode, const std::string &path = {},
+                     float replayTimestep = DEFAULT_REPLAY_TIMESTEP);
+            ~LotInput();
+
+            LotInput(const LotInput &) = delete;
+            LotInput &operator=(const LotInput &) = delete;
+
+            // glfwPollEvents 직후 프레임마다 한 번 호출 (이전 프레임 에지를 지우고 쌓인 이벤트를 반영)
+            // 이번 프레임에 시뮬레이션이 쓸 시간 간격을 반환 (Replay는 고정 간격, 나머지는 wallFrameTime)
+            float beginFrame(float wallFrameTime);
+
+            Mode getMode() const { return mode; }
+            // 재생할 이벤트가 모두 끝났으면 true (Replay 전용)
+            bool isReplayFinished() const { return mode == Mode::Replay && time > endTime; }
+
+            // 액션 바인딩 (기본값은 bindDefaultActions, 액션당 MAX_ACTION_BINDINGS개까지)
+            void bindAction(LotInputAction action, LotInputBinding binding);
+            void clearActionBindings(LotInputAction action);
+            void bindDefaultActions();
+
+            // 연결된 키/버튼 중 하나라도 눌려 있으면 down, 이번 프레임에 눌렸/떼졌으면 pressed/released
+            bool isActionDown(LotInputAction action) const;
+            bool isActionPressed(LotInputAction action) const;
+            bool isActionReleased(LotInputAction action) const;
+
+            bool isKeyDown(int key) const { return isValidKey(key) && keys.down[key]; }
+            bool isKeyPressed(int key) const { return isValidKey(key) && keys.pressed[key]; }
+            bool isKeyReleased(int key) const { return isValidKey(key) && keys.released[key]; }
+            bool isMouseButtonDown(int button) const { return isValidButton(button) && buttons.down[button]; }
+            bool isMouseButtonPressed(int button) const { return isValidButton(button) && buttons.pressed[button]; }
+            bool isMouseButtonReleased(int button) const { return isValidButton(button) && buttons.released[button]; }
+
+            void getCursorPos(double &x, double &y) const { x = cursorX; y = cursorY; }
+            void getWindowSize(int &width, int &height) const { width = windowWidth; height = windowHeight; }
+            // 이번 프레임에 들어온 세로 스크롤 양
+            double getScrollDelta() const { return scrollDelta; }
+            // 이번 프레임에 창 크기가 바뀌었는지
+            bool wasWindowResized() const { return windowResized; }
+            // 눌려 있는 키/버튼이 하나라도 있는지 (누르고 있는 동안 카메라/객체가 계속 움직일 수 있음)
+            bool isAnyInputDown() const { return keys.down.any() || buttons.down.any(); }
+
+        private:
+            static constexpr int KEY_COUNT = GLFW_KEY_LAST + 1;
+            static constexpr int BUTTON_COUNT = GLFW_MOUSE_BUTTON_LAST + 1;
+            static constexpr size_t ACTION_COUNT = static_cast<size_t>(LotInputAction::Count);
+
+            template <size_t N>
+            struct ButtonStates {
+                std::bitset<N> down;
+                // 이번 프레임에 바뀐 입력 (한 프레임 안에 눌렀다 떼면 둘 다 켜짐)
+                std::bitset<N> pressed;
+                std::bitset<N> released;
+
+                void apply(int code, bool isDown) {
+                    down[code] = isDown;
+                    (isDown ? pressed : released)[code] = true;
+                }
+            };
+
+            static bool isValidKey(int key) { return key >= 0 && key < KEY_COUNT; }
+            static bool isValidButton(int button) { return button >= 0 && button < BUTTON_COUNT; }
+
+            static void keyCallback(GLFWwindow *window, int key, int scancode, int action, int mods);
+            static void mouseButtonCallback(GLFWwindow *window, int button, int action, int mods);
+            static void cursorPosCallback(GLFWwindow *window, double x, double y);
+            static void scrollCallback(GLFWwindow *window, double xoffset, double yoffset);
+            static void windowSizeCallback(GLFWwindow *window, int width, int height);
+
+            void registerCallbacks();
+            void unregisterCallbacks();
+            void queueButtonEvent(LotInputEvent::Type type, int code, int action);
+            void flushPendingEvents();
+            void loadRecording(const std::string &path);
+            void applyEvent(const LotInputEvent &event);
+            void record(const LotInputEvent &event);
+
+            template <typename Predicate>
+            bool anyBinding(LotInputAction action, Predicate predicate) const;
+
+            // GLFW 콜백이 찾을 인스턴스 (창 사용자 포인터는 LotWindow가 쓰고 있고, 창은 하나뿐)
+            static LotInput *instance;
+
+            GLFWwindow *window;
+            Mode mode;
+            float replayTimestep;
+
+            uint64_t frameNumber = 0;
+            double time = 0.0;
+            double startTime = 0.0;
+
+            ButtonStates<KEY_COUNT> keys;
+            ButtonStates<BUTTON_COUNT> buttons;
+            std::array<std::array<LotInputBinding, MAX_ACTION_BINDINGS>, ACTION_COUNT> actionBindings{};
+
+            double cursorX = 0.0;
+            double cursorY = 0.0;
+            int windowWidth = 0;
+            int windowHeight = 0;
+            double scrollDelta = 0.0;
+            bool windowResized = false;
+
+            // 콜백이 다음 beginFrame까지 쌓아 두는 입력 (time은 glfwGetTime 기준)
+            // 키/버튼은 순서대로, 커서/창 크기는 마지막 값만, 스크롤은 합계만 남김
+            std::vector<LotInputEvent> pendingButtonEvents;
+            bool hasPendingCursor = false;
+            double pendingCursorX = 0.0;
+            double pendingCursorY = 0.0;
+            bool hasPendingWindowSize = false;
+            int pendingWindowWidth = 0;
+            int pendingWindowHeight = 0;
+            double pendingScroll = 0.0;
+
+            std::ofstream recordFile;
+
+            std::vector<LotInputEvent> replayEvents;
+            size_t replayPosition = 0;
+            double endTime = 0.0;
+    };
+} // namespace lot
@@ -0,0 +1,274 @@
+#include "lot_job_system.h"
+#include "lot_cpu_profiler.h"
+#include "lot_log.h"
+
+// std
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+namespace lot {
+    namespace {
+        std::atomic<uint64_t> nextInstanceId{1};
+
+        static_assert(LotJobSystem::MAX_EXTERNAL_THREADS <= 32, "external slots are tracked in a 32-bit mask");
+
+        // 스레드가 어느 잡 시스템의 어느 슬롯을 쓰는지 기억
+        // 외부 스레드는 스레드가 끝날 때(또는 다른 잡 시스템에 묶일 때) 슬롯을 반납
+        struct ThreadSlotBinding {
+            uint64_t instanceId = 0;
+            uint32_t slot = 0;
+            std::shared_ptr<std::atomic<uint32_t>> externalSlotMask;
+            uint32_t externalIndex = 0;
+
+            ~ThreadSlotBinding() { release(); }
+
+            void release() {
+                if (externalSlotMask) {
+                    // release: 다음 소유 스레드가 이 슬롯의 덱/잡 풀 상태를 이어받음
+                    externalSlotMask->fetch_and(~(1u << externalIndex), std::memory_order_release);
+                    externalSlotMask.reset();
+                }
+                instanceId = 0;
+            }
+        };
+        thread_local ThreadSlotBinding threadSlotBinding{};
+
+        // 잡이 없을 때 잠들기 전까지 양보(yield)하는 횟수
+        constexpr int IDLE_SPIN_COUNT = 64;
+    }
+
+    bool LotJobSystem::WorkStealingQueue::push(Job *job) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= static_cast<int64_t>(MAX_JOBS_PER_THREAD)) {
+            return false;
+        }
+
+        jobs[b & MASK].store(job, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    LotJobSystem::Job *LotJobSystem::WorkStealingQueue::pop() {
+        // bottom 감소와 top 읽기 사이의 순서는 steal과 동일한 seq_cst 순서로 보장
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_seq_cst);
+
+        if (t > b) {
+            // 비어 있음
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Job *job = jobs[b & MASK].load(std::memory_order_relaxed);
+        if (t != b) {
+            // 남은 잡이 두 개 이상이면 steal과 경쟁하지 않음
+            return job;
+        }
+
+        // 마지막 잡: steal과 top을 두고 경쟁
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return job;
+    }
+
+    LotJobSystem::Job *LotJobSystem::WorkStealingQueue::steal() {
+        int64_t t = top.load(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_seq_cst);
+
+        if (t >= b) {
+            return nullptr;
+        }
+
+        Job *job = jobs[t & MASK].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;   // 다른 스레드가 먼저 가져감
+        }
+        return job;
+    }
+
+    LotJobSystem::LotJobSystem(uint32_t workerCount)
+    : instanceId{nextInstanceId.fetch_add(1)}, externalSlotMask{std::make_shared<std::atomic<uint32_t>>(0)} {
+        uint32_t slotCount = workerCount + MAX_EXTERNAL_THREADS;
+        slots.reserve(slotCount);
+        for (uint32_t i = 0; i < slotCount; i++) {
+            auto slot = std::make_unique<ThreadSlot>();
+            slot->jobPool = std::make_unique<Job[]>(MAX_JOBS_PER_THREAD);
+            slot->stealSeed = i * 2654435761u + 1;
+            slots.push_back(std::move(slot));
+        }
+
+        workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; i++) {
+            workers.emplace_back(&LotJobSystem::workerLoop, this, i);
+        }
+    }
+
+    LotJobSystem::~LotJobSystem() {
+        running = false;
+        {
+            std::lock_guard<std::mutex> lock{wakeMutex};
+            wakeCondition.notify_all();
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+
+    LotJobSystem &LotJobSystem::instance() {
+        static LotJobSystem jobSystem{[] {
+            // 메인 스레드 몫을 빼고 나머지 코어를 워커로 사용
+            uint32_t hardwareThreads = std::thread::hardware_concurrency();
+            uint32_t defaultWorkers = hardwareThreads > 1 ? hardwareThreads - 1 : 0u;
+            const char *env = std::getenv("LOT_JOB_WORKERS");
+            if (env == nullptr) {
+                return defaultWorkers;
+            }
+
+            // 잘못된 값으로 시작부터 죽지 않도록 기본값으로 대체하고, 과도한 값은 코어 수의 두 배로 제한
+            char *end = nullptr;
+            errno = 0;
+            unsigned long requested = std::strtoul(env, &end, 10);
+            if (!std::isdigit(static_cast<unsigned char>(env[0])) || *end != '\0' || errno == ERANGE) {
+                LOT_LOG_WARN("LOT_JOB_WORKERS '{}' is not a worker count, using {}", std::string{env}, defaultWorkers);
+                return defaultWorkers;
+            }
+            uint32_t maxWorkers = std::max(hardwareThreads, 1u) * 2;
+            if (requested > maxWorkers) {
+                LOT_LOG_WARN("LOT_JOB_WORKERS {} is too large, using {}", requested, maxWorkers);
+                return maxWorkers;
+            }
+            return static_cast<uint32_t>(requested);
+        }()};
+        return jobSystem;
+    }
+
+    uint32_t LotJobSystem::currentThreadSlot() {
+        if (threadSlotBinding.instanceId == instanceId) {
+            return threadSlotBinding.slot;
+        }
+
+        // 워커가 아닌 스레드는 처음 호출할 때 비어 있는 외부 슬롯을 하나 할당받음
+        // (짧게 사는 스레드가 끝나면 반납되므로 동시에 살아 있는 호출자 수만 MAX_EXTERNAL_THREADS로 제한됨)
+        threadSlotBinding.release();
+        uint32_t used = externalSlotMask->load(std::memory_order_acquire);
+        uint32_t external;
+        do {
+            external = 0;
+            while (external < MAX_EXTERNAL_THREADS && (used & (1u << external)) != 0) {
+                external++;
+            }
+            if (external == MAX_EXTERNAL_THREADS) {
+                throw std::runtime_error("too many threads submitting jobs to LotJobSystem at once!");
+            }
+        } while (!externalSlotMask->compare_exchange_weak(used, used | (1u << external),
+                                                          std::memory_order_acquire, std::memory_order_acquire));
+
+        threadSlotBinding.instanceId = instanceId;
+        threadSlotBinding.slot = static_cast<uint32_t>(workers.size()) + external;
+        threadSlotBinding.externalSlotMask = externalSlotMask;
+        threadSlotBinding.externalIndex = external;
+        return threadSlotBinding.slot;
+    }
+
+    LotJobSystem::Job *LotJobSystem::allocateJob() {
+        // 슬롯별 링 버퍼 할당: 동시에 살아 있는 잡이 MAX_JOBS_PER_THREAD를 넘지 않는다는 가정
+        ThreadSlot &slot = *slots[currentThreadSlot()];
+        uint32_t index = slot.allocatedJobs++ & (MAX_JOBS_PER_THREAD - 1);
+        return &slot.jobPool[index];
+    }
+
+    void LotJobSystem::run(Job *job) {
+        if (workers.empty() || !slots[currentThreadSlot()]->queue.push(job)) {
+            // 워커가 없거나 덱이 가득 찼으면 호출 스레드에서 바로 실행
+            execute(job);
+            return;
+        }
+
+        if (sleepingWorkers.load(std::memory_order_acquire) > 0) {
+            std::lock_guard<std::mutex> lock{wakeMutex};
+            wakeCondition.notify_one();
+        }
+    }
+
+    void LotJobSystem::wait(const Job *job) {
+        uint32_t slot = currentThreadSlot();
+        while (job->unfinishedJobs.load(std::memory_order_acquire) > 0) {
+            if (Job *next = getJob(slot)) {
+                execute(next);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    LotJobSystem::Job *LotJobSystem::getJob(uint32_t slot) {
+        if (Job *job = slots[slot]->queue.pop()) {
+            return job;
+        }
+
+        // 자기 덱이 비었으면 임의의 슬롯부터 돌아가며 훔쳐옴
+        uint32_t slotCount = static_cast<uint32_t>(slots.size());
+        uint32_t &seed = slots[slot]->stealSeed;
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        uint32_t start = seed % slotCount;
+
+        for (uint32_t i = 0; i < slotCount; i++) {
+            uint32_t victim = (start + i) % slotCount;
+            if (victim == slot) continue;
+            if (Job *job = slots[victim]->queue.steal()) {
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    void LotJobSystem::execute(Job *job) {
+        job->function(job);
+        finish(job);
+    }
+
+    void LotJobSystem::finish(Job *job) {
+        // 카운터가 0이 되는 순간 잡 슬롯이 재사용될 수 있으므로 부모는 먼저 읽어둠
+        Job *parent = job->parent;
+        if (job->unfinishedJobs.fetch_sub(1, std::memory_order_acq_rel) == 1 && parent) {
+            finish(parent);
+        }
+    }
+
+    void LotJobSystem::workerLoop(uint32_t slot) {
+        threadSlotBinding.instanceId = instanceId;
+        threadSlotBinding.slot = slot;
+        LOT_PROFILE_THREAD("JobWorker");
+
+        int idleSpins = 0;
+        while (running.load(std::memory_order_acquire)) {
+            if (Job *job = getJob(slot)) {
+                execute(job);
+                idleSpins = 0;
+                continue;
+            }
+
+            if (++idleSpins < IDLE_SPIN_COUNT) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // 알림을 놓쳐도 짧은 타임아웃 후 다시 훔치기를 시도함
+            std::unique_lock<std::mutex> lock{wakeMutex};
+            sleepingWorkers.fetch_add(1, std::memory_order_acq_rel);
+            wakeCondition.wait_for(lock, std::chrono::milliseconds(1));
+            sleepingWorkers.fetch_sub(1, std::memory_order_acq_rel);
+            idleSpins = 0;
+        }
+    }
+} // namespace lot
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lot {
+    // 작업 훔치기(work-stealing) 기반 잡 시스템
+    // - 스레드 슬롯마다 Chase-Lev 덱을 하나씩 가짐 (소유 스레드는 bottom에서 push/pop, 나머지는 top에서 steal)
+    // - 잡은 부모를 가질 수 있고, 부모는 모든 자식이 끝나야 완료됨
+    // - wait()는 잠들지 않고 대기하는 동안 다른 잡을 실행함
+    class LotJobSystem {
+        public:
+            static constexpr size_t JOB_DATA_SIZE = 96;
+            static constexpr uint32_t MAX_JOBS_PER_THREAD = 4096;     // 2의 거듭제곱
+            static constexpr uint32_t MAX_EXTERNAL_THREADS = 8;       // 동시에 잡을 제출하는 워커가 아닌 스레드 수
+
+            struct Job {
+                void (*function)(Job *) = nullptr;
+                Job *parent = nullptr;
+                std::atomic<int32_t> unfinishedJobs{0};
+                alignas(std::max_align_t) unsigned char data[JOB_DATA_SIZE];
+            };
+
+            // 워커 수가 0이면 모든 잡이 호출 스레드에서 실행됨
+            explicit LotJobSystem(uint32_t workerCount);
+            ~LotJobSystem();
+
+            LotJobSystem(const LotJobSystem &) = delete;
+            LotJobSystem &operator=(const LotJobSystem &) = delete;
+
+            // 엔진 전역 인스턴스 (LOT_JOB_WORKERS 환경 변수로 워커 수 지정 가능)
+            static LotJobSystem &instance();
+
+            uint32_t getWorkerCount() const { return static_cast<uint32_t>(workers.size()); }
+            uint32_t getThreadSlotCount() const { return static_cast<uint32_t>(slots.size()); }
+
+            // 호출 스레드의 슬롯 번호 (워커는 고정, 그 외 스레드는 첫 호출 시 할당하고 스레드가 끝나면 반납)
+            // 스레드별 자원(커맨드 풀 등)을 인덱싱할 때 사용
+            uint32_t currentThreadSlot();
+
+            template <typename Fn>
+            Job *createJob(Fn &&fn, Job *parent = nullptr) {
+                using Callable = std::decay_t<Fn>;
+                static_assert(sizeof(Callable) <= JOB_DATA_SIZE, "job callable is too large");
+                static_assert(alignof(Callable) <= alignof(std::max_align_t), "job callable is over-aligned");
+
+                Job *job = allocateJob();
+                job->parent = parent;
+                job->unfinishedJobs.store(1, std::memory_order_relaxed);
+                new (job->data) Callable(std::forward<Fn>(fn));
+                job->function = [](Job *self) {
+                    Callable *callable = std::launder(reinterpret_cast<Callable *>(self->data));
+                    (*callable)();
+                    callable->~Callable();
+                };
+
+                if (parent) {
+                    parent->unfinishedJobs.fetch_add(1, std::memory_order_relaxed);
+                }
+                return job;
+            }
+
+            void run(Job *job);
+            void wait(const Job *job);
+
+            // [0, count) 범위를 grainSize 이상 크기의 구간으로 나눠 fn(begin, end)를 병렬 실행
+            template <typename Fn>
+            void parallelFor(size_t count, size_t grainSize, Fn &&fn) {
+                if (count == 0) return;
+                grainSize = std::max<size_t>(grainSize, 1);
+
+                if (workers.empty() || count <= grainSize) {
+                    fn(size_t{0}, count);
+                    return;
+                }
+
+                size_t chunkCount = (count + grainSize - 1) / grainSize;
+                chunkCount = std::min<size_t>(chunkCount, MAX_PARALLEL_FOR_CHUNKS);
+                size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+                Job *root = createJob([] {});
+                for (size_t begin = 0; begin < count; begin += chunkSize) {
+                    size_t end = std::min(begin + chunkSize, count);
+                    run(createJob([&fn, begin, end] { fn(begin, end); }, root));
+                }
+                run(root);
+                wait(root);
+            }
+
+        private:
+            static constexpr size_t MAX_PARALLEL_FOR_CHUNKS = 256;
+
+            // 고정 크기 Chase-Lev 덱
+            class WorkStealingQueue {
+                public:
+                    bool push(Job *job);
+                    Job *pop();
+                    Job *steal();
+
+                private:
+                    static constexpr int64_t MASK = MAX_JOBS_PER_THREAD - 1;
+
+                    alignas(64) std::atomic<int64_t> top{0};
+                    alignas(64) std::atomic<int64_t> bottom{0};
+                    std::atomic<Job *> jobs[MAX_JOBS_PER_THREAD] = {};
+            };
+
+            struct ThreadSlot {
+                WorkStealingQueue queue;
+                std::unique_ptr<Job[]> jobPool;
+                uint32_t allocatedJobs = 0;
+                uint32_t stealSeed = 0;
+            };
+
+            Job *allocateJob();
+            Job *getJob(uint32_t slot);
+            void execute(Job *job);
+            void finish(Job *job);
+            void workerLoop(uint32_t slot);
+
+            const uint64_t instanceId;
+            std::vector<std::unique_ptr<ThreadSlot>> slots;
+            // 사용 중인 외부 슬롯 비트 (스레드 종료 시 반납하므로 잡 시스템보다 오래 살 수 있게 공유)
+            std::shared_ptr<std::atomic<uint32_t>> externalSlotMask;
+
+            std::vector<std::thread> workers;
+            std::atomic<bool> running{true};
+
+            // 할 일이 없을 때 워커를 재우기 위한 조건 변수
+            std::mutex wakeMutex;
+            std::condition_variable wakeCondition;
+            std::atomic<uint32_t> sleepingWorkers{0};
+    };
+} // namespace lot
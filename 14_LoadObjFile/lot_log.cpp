@@ -0,0 +1,196 @@
+#include "lot_log.h"
+
+// std
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace lot {
+    // 큐가 비었을 때 출력 스레드가 다시 확인하기까지의 시간 (생산자는 알림을 보내지 않음)
+    static constexpr auto WRITER_IDLE_SLEEP = std::chrono::milliseconds(2);
+    static constexpr uint64_t RATE_WINDOW_NS = 1'000'000'000ull;
+
+    namespace {
+        const char *levelName(LotLogLevel level) {
+            switch (level) {
+                case LotLogLevel::Trace: return "TRACE";
+                case LotLogLevel::Debug: return "DEBUG";
+                case LotLogLevel::Info: return "INFO";
+                case LotLogLevel::Warn: return "WARN";
+                case LotLogLevel::Error: return "ERROR";
+            }
+            return "?";
+        }
+
+        LotLogLevel levelFromEnvironment() {
+            const char *env = std::getenv("LOT_LOG_LEVEL");
+            if (env == nullptr) {
+                return LotLogLevel::Info;
+            }
+            const std::pair<const char *, LotLogLevel> names[] = {
+                {"trace", LotLogLevel::Trace}, {"debug", LotLogLevel::Debug}, {"info", LotLogLevel::Info},
+                {"warn", LotLogLevel::Warn}, {"error", LotLogLevel::Error}};
+            for (const auto &[name, value] : names) {
+                if (std::strcmp(env, name) == 0) {
+                    return value;
+                }
+            }
+            std::cerr << "[Log] Unknown LOT_LOG_LEVEL '" << env << "', using info" << std::endl;
+            return LotLogLevel::Info;
+        }
+
+        // 경로를 빼고 파일 이름만
+        const char *baseName(const char *path) {
+            const char *name = path;
+            for (const char *c = path; *c != '\0'; c++) {
+                if (*c == '/' || *c == '\\') {
+                    name = c + 1;
+                }
+            }
+            return name;
+        }
+    }
+
+    LotLogger::LotLogger()
+    : level{static_cast<uint32_t>(levelFromEnvironment())},
+      epochNs{now()},
+      cells{std::make_unique<Cell[]>(QUEUE_CAPACITY)} {
+        for (uint64_t i = 0; i < QUEUE_CAPACITY; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        writerThread = std::thread(&LotLogger::writerLoop, this);
+    }
+
+    LotLogger::~LotLogger() {
+        running = false;
+        if (writerThread.joinable()) {
+            writerThread.join();
+        }
+    }
+
+    LotLogger &LotLogger::instance() {
+        static LotLogger logger;
+        return logger;
+    }
+
+    uint64_t LotLogger::now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    bool LotLogger::shouldLog(LotLogSite &site) {
+        if (static_cast<uint32_t>(site.level) < level.load(std::memory_order_relaxed)) {
+            return false;
+        }
+
+        // 1초 창마다 maxPerSecond개까지 허용 (창을 넘긴 스레드 하나만 창을 새로 시작)
+        uint64_t timeNs = now();
+        uint64_t windowStart = site.windowStartNs.load(std::memory_order_relaxed);
+        if (timeNs - windowStart >= RATE_WINDOW_NS &&
+            site.windowStartNs.compare_exchange_strong(windowStart, timeNs, std::memory_order_relaxed)) {
+            site.windowCount.store(0, std::memory_order_relaxed);
+        }
+        if (site.windowCount.fetch_add(1, std::memory_order_relaxed) >= site.maxPerSecond) {
+            site.suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    LotLogger::Cell *LotLogger::reserve(uint64_t &position) {
+        position = enqueuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            Cell &cell = cells[position & (QUEUE_CAPACITY - 1)];
+            uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+            int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+            if (difference == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    return &cell;
+                }
+            } else if (difference < 0) {
+                // 출력 스레드가 한 바퀴 뒤처짐: 가득 참
+                return nullptr;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void LotLogger::commit(Cell &cell, uint64_t position) {
+        cell.sequence.store(position + 1, std::memory_order_release);
+    }
+
+    void LotLogger::writeUntilPlaceholder(std::ostream &out, const char *&format) {
+        const char *placeholder = std::strstr(format, "{}");
+        if (placeholder == nullptr) {
+            out << format;
+            format += std::strlen(format);
+            return;
+        }
+        out.write(format, placeholder - format);
+        format = placeholder + 2;
+    }
+
+    bool LotLogger::drainOnce(std::ostream &out) {
+        bool wroteAny = false;
+        while (true) {
+            Cell &cell = cells[dequeuePosition & (QUEUE_CAPACITY - 1)];
+            if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) {
+                break;
+            }
+
+            Record &record = cell.record;
+            double seconds = static_cast<double>(record.timeNs - epochNs) / 1e9;
+            out << "[" << std::fixed << std::setprecision(3) << seconds << "][" << levelName(record.site->level)
+                << "][" << baseName(record.site->file) << ":" << record.site->line << "] ";
+            out.unsetf(std::ios::floatfield);
+            out << std::setprecision(6);
+            record.format(out, record.payload);
+            if (record.suppressed > 0) {
+                out << " (" << record.suppressed << " similar messages suppressed)";
+            }
+            out << '\n';
+            record.destroy(record.payload);
+
+            cell.sequence.store(dequeuePosition + QUEUE_CAPACITY, std::memory_order_release);
+            dequeuePosition++;
+            written.fetch_add(1, std::memory_order_release);
+            wroteAny = true;
+        }
+
+        uint64_t droppedCount = dropped.exchange(0, std::memory_order_relaxed);
+        if (droppedCount > 0) {
+            out << "[Log] " << droppedCount << " messages dropped (queue full)\n";
+            wroteAny = true;
+        }
+        return wroteAny;
+    }
+
+    void LotLogger::writerLoop() {
+        while (true) {
+            bool stopping = !running.load(std::memory_order_acquire);
+            if (drainOnce(std::cout)) {
+                std::cout.flush();
+                flushCondition.notify_all();
+                continue;
+            }
+            if (stopping) {
+                break;
+            }
+            flushCondition.notify_all();
+            std::this_thread::sleep_for(WRITER_IDLE_SLEEP);
+        }
+    }
+
+    void LotLogger::flush() {
+        // 예약만 하고 아직 쓰지 않은 칸이 있을 수 있으므로 예약된 위치까지 출력되기를 기다림
+        uint64_t target = enqueuePosition.load(std::memory_order_acquire);
+        std::unique_lock<std::mutex> lock{flushMutex};
+        flushCondition.wait_for(lock, std::chrono::seconds(1), [&] {
+            return written.load(std::memory_order_acquire) >= target;
+        });
+    }
+} // namespace lot
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// 이 값보다 낮은 레벨의 LOT_LOG_* 는 컴파일 시 제거됨 (0=TRACE, 1=DEBUG, 2=INFO, 3=WARN, 4=ERROR)
+#ifndef LOT_LOG_COMPILE_LEVEL
+    #define LOT_LOG_COMPILE_LEVEL 1
+#endif
+
+namespace lot {
+    enum class LotLogLevel : uint32_t {
+        Trace = 0,
+        Debug = 1,
+        Info = 2,
+        Warn = 3,
+        Error = 4
+    };
+
+    // 호출 지점마다 하나씩 정적으로 생성 (LOT_LOG_* 매크로가 만듦)
+    // 초당 maxPerSecond개를 넘는 메시지는 버리고 개수만 세어 다음 메시지에 붙임
+    struct LotLogSite {
+        LotLogLevel level;
+        const char *file;
+        int line;
+        uint32_t maxPerSecond;
+
+        std::atomic<uint64_t> windowStartNs{0};
+        std::atomic<uint32_t> windowCount{0};
+        std::atomic<uint32_t> suppressed{0};
+    };
+
+    // 비동기 로거
+    // - 호출 스레드는 인자를 값으로 복사해 잠금 없는 MPSC 링에 넣기만 하고, 문자열 변환과 출력은
+    //   전용 스레드가 담당 (형식 문자열의 {} 자리에 인자를 순서대로 출력)
+    // - 링이 가득 차면 호출 스레드를 막지 않고 메시지를 버린 뒤 버린 개수를 출력
+    // - 실행 시 레벨은 LOT_LOG_LEVEL 환경 변수(trace/debug/info/warn/error, 기본 info)
+    // - const char* 인자는 포인터만 복사하므로 문자열 리터럴/정적 문자열만 넘기고, 나머지는 std::string으로 넘김
+    class LotLogger {
+        public:
+            static constexpr size_t QUEUE_CAPACITY = 4096;   // 2의 거듭제곱
+            static constexpr size_t PAYLOAD_SIZE = 192;
+            static constexpr uint32_t DEFAULT_RATE_LIMIT = 30;
+
+            static LotLogger &instance();
+            ~LotLogger();
+
+            LotLogger(const LotLogger &) = delete;
+            LotLogger &operator=(const LotLogger &) = delete;
+
+            void setLevel(LotLogLevel value) { level.store(static_cast<uint32_t>(value), std::memory_order_relaxed); }
+            LotLogLevel getLevel() const { return static_cast<LotLogLevel>(level.load(std::memory_order_relaxed)); }
+
+            // 레벨과 호출 지점 속도 제한 검사 (통과하지 못하면 인자 복사도 하지 않음)
+            bool shouldLog(LotLogSite &site);
+
+            template <typename... Args>
+            void log(LotLogSite &site, const char *format, Args &&...args);
+
+            // 지금까지 넣은 메시지가 모두 출력될 때까지 대기
+            void flush();
+
+        private:
+            using FormatFn = void (*)(std::ostream &, void *);
+            using DestroyFn = void (*)(void *);
+
+            struct Record {
+                const LotLogSite *site = nullptr;
+                uint64_t timeNs = 0;
+                uint32_t suppressed = 0;
+                FormatFn format = nullptr;
+                DestroyFn destroy = nullptr;
+                alignas(std::max_align_t) unsigned char payload[PAYLOAD_SIZE];
+            };
+
+            // Vyukov 방식 유계 큐의 칸 (sequence로 생산자/소비자 차례를 구분)
+            struct Cell {
+                std::atomic<uint64_t> sequence{0};
+                Record record;
+            };
+
+            template <typename... Args>
+            struct Payload {
+                const char *format;
+                std::tuple<Args...> args;
+
+                static void write(std::ostream &out, void *memory);
+                static void destroy(void *memory) { static_cast<Payload *>(memory)->~Payload(); }
+            };
+
+            LotLogger();
+
+            // 생산자: 비어 있는 칸을 예약 (가득 차면 nullptr)
+            Cell *reserve(uint64_t &position);
+            void commit(Cell &cell, uint64_t position);
+            void writerLoop();
+            bool drainOnce(std::ostream &out);
+            static uint64_t now();
+            // format에서 다음 {} 앞까지 출력하고 그 뒤로 이동 (없으면 끝까지 출력)
+            static void writeUntilPlaceholder(std::ostream &out, const char *&format);
+
+            std::atomic<uint32_t> level;
+            uint64_t epochNs;
+
+            std::unique_ptr<Cell[]> cells;
+            alignas(64) std::atomic<uint64_t> enqueuePosition{0};
+            alignas(64) uint64_t dequeuePosition = 0;
+            std::atomic<uint64_t> dropped{0};
+            std::atomic<uint64_t> written{0};
+
+            std::atomic<bool> running{true};
+            std::mutex flushMutex;
+            std::condition_variable flushCondition;
+            std::thread writerThread;
+    };
+
+    template <typename... Args>
+    void LotLogger::Payload<Args...>::write(std::ostream &out, void *memory) {
+        auto &payload = *static_cast<Payload *>(memory);
+        const char *format = payload.format;
+        std::apply([&](const auto &...values) {
+            ((writeUntilPlaceholder(out, format), out << values), ...);
+        }, payload.args);
+        out << format;
+    }
+
+    template <typename... Args>
+    void LotLogger::log(LotLogSite &site, const char *format, Args &&...args) {
+        using PayloadType = Payload<std::decay_t<Args>...>;
+        static_assert(sizeof(PayloadType) <= PAYLOAD_SIZE, "log arguments are too large; pass fewer values");
+        static_assert(alignof(PayloadType) <= alignof(std::max_align_t), "log argument alignment is not supported");
+
+        uint64_t position = 0;
+        Cell *cell = reserve(position);
+        if (cell == nullptr) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        Record &record = cell->record;
+        record.site = &site;
+        record.timeNs = now();
+        record.suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+        record.format = &PayloadType::write;
+        record.destroy = &PayloadType::destroy;
+        new (record.payload) PayloadType{format, std::tuple<std::decay_t<Args>...>{std::forward<Args>(args)...}};
+        commit(*cell, position);
+    }
+} // namespace lot
+
+#define LOT_LOG_AT(levelValue, rateLimit, ...)                                                              \
+    do {                                                                                                    \
+        static ::lot::LotLogSite lotLogSite{levelValue, __FILE__, __LINE__, rateLimit};                      \
+        if (::lot::LotLogger::instance().shouldLog(lotLogSite)) {                                           \
+            ::lot::LotLogger::instance().log(lotLogSite, __VA_ARGS__);                                      \
+        }                                                                                                   \
+    } while (0)
+
+#define LOT_LOG_DISABLED(...) ((void)0)
+
+#if LOT_LOG_COMPILE_LEVEL <= 0
+    #define LOT_LOG_TRACE(...) LOT_LOG_AT(::lot::LotLogLevel::Trace, ::lot::LotLogger::DEFAULT_RATE_LIMIT, __VA_ARGS__)
+#else
+    #define LOT_LOG_TRACE(...) LOT_LOG_DISABLED(__VA_ARGS__)
+#endif
+#if LOT_LOG_COMPILE_LEVEL <= 1
+    #define LOT_LOG_DEBUG(...) LOT_LOG_AT(::lot::LotLogLevel::Debug, ::lot::LotLogger::DEFAULT_RATE_LIMIT, __VA_ARGS__)
+#else
+    #define LOT_LOG_DEBUG(...) LOT_LOG_DISABLED(__VA_ARGS__)
+#endif
+#if LOT_LOG_COMPILE_LEVEL <= 2
+    #define LOT_LOG_INFO(...) LOT_LOG_AT(::lot::LotLogLevel::Info, ::lot::LotLogger::DEFAULT_RATE_LIMIT, __VA_ARGS__)
+#else
+    #define LOT_LOG_INFO(...) LOT_LOG_DISABLED(__VA_ARGS__)
+#endif
+#if LOT_LOG_COMPILE_LEVEL <= 3
+    #define LOT_LOG_WARN(...) LOT_LOG_AT(::lot::LotLogLevel::Warn, ::lot::LotLogger::DEFAULT_RATE_LIMIT, __VA_ARGS__)
+#else
+    #define LOT_LOG_WARN(...) LOT_LOG_DISABLED(__VA_ARGS__)
+#endif
+// ERROR는 제거하지 않음
+#define LOT_LOG_ERROR(...) LOT_LOG_AT(::lot::LotLogLevel::Error, ::lot::LotLogger::DEFAULT_RATE_LIMIT, __VA_ARGS__)
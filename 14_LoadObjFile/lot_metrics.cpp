@@ -0,0 +1,140 @@
+#include "lot_metrics.h"
+
+// std
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+
+namespace lot {
+    namespace {
+        uint64_t steadyNowNs() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+    }
+
+    // *************** Histogram *********************
+
+    LotHistogram::LotHistogram(std::vector<double> upperBounds)
+    : upperBounds{std::move(upperBounds)} {
+        std::sort(this->upperBounds.begin(), this->upperBounds.end());
+        bucketCounts = std::make_unique<std::atomic<uint64_t>[]>(this->upperBounds.size() + 1);
+        for (size_t i = 0; i <= this->upperBounds.size(); i++) {
+            bucketCounts[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void LotHistogram::observe(double value) {
+        // 버킷은 수 개~수십 개이므로 선형 탐색
+        size_t bucket = 0;
+        while (bucket < upperBounds.size() && value > upperBounds[bucket]) {
+            bucket++;
+        }
+        bucketCounts[bucket].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+
+        double current = sum.load(std::memory_order_relaxed);
+        while (!sum.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::vector<uint64_t> LotHistogram::getBucketCounts() const {
+        std::vector<uint64_t> counts(upperBounds.size() + 1);
+        for (size_t i = 0; i < counts.size(); i++) {
+            counts[i] = bucketCounts[i].load(std::memory_order_relaxed);
+        }
+        return counts;
+    }
+
+    // *************** Metrics Registry *********************
+
+    LotMetrics::LotMetrics() : startNs{steadyNowNs()} {}
+
+    LotMetrics &LotMetrics::instance() {
+        static LotMetrics metrics;
+        return metrics;
+    }
+
+    void LotMetrics::checkUnique(const std::string &name, const char *kind) const {
+        if (counters.count(name) + gauges.count(name) + histograms.count(name) > 0) {
+            throw std::runtime_error("metric '" + name + "' is already registered with a type other than " + kind);
+        }
+    }
+
+    LotCounter &LotMetrics::counter(const std::string &name) {
+        std::lock_guard<std::mutex> lock{registryMutex};
+        auto it = counters.find(name);
+        if (it != counters.end()) {
+            return *it->second;
+        }
+        checkUnique(name, "counter");
+        return *(counters[name] = std::make_unique<LotCounter>());
+    }
+
+    LotGauge &LotMetrics::gauge(const std::string &name) {
+        std::lock_guard<std::mutex> lock{registryMutex};
+        auto it = gauges.find(name);
+        if (it != gauges.end()) {
+            return *it->second;
+        }
+        checkUnique(name, "gauge");
+        return *(gauges[name] = std::make_unique<LotGauge>());
+    }
+
+    LotHistogram &LotMetrics::histogram(const std::string &name, std::vector<double> upperBounds) {
+        std::lock_guard<std::mutex> lock{registryMutex};
+        auto it = histograms.find(name);
+        if (it != histograms.end()) {
+            return *it->second;
+        }
+        checkUnique(name, "histogram");
+        return *(histograms[name] = std::make_unique<LotHistogram>(std::move(upperBounds)));
+    }
+
+    void LotMetrics::writeJson(std::ostream &out) const {
+        std::lock_guard<std::mutex> lock{registryMutex};
+        out << "{\"uptimeSeconds\": " << static_cast<double>(steadyNowNs() - startNs) / 1e9;
+
+        out << ", \"counters\": {";
+        bool first = true;
+        for (const auto &[name, counter] : counters) {
+            out << (first ? "" : ", ") << "\"" << name << "\": " << counter->get();
+            first = false;
+        }
+
+        out << "}, \"gauges\": {";
+        first = true;
+        for (const auto &[name, gauge] : gauges) {
+            out << (first ? "" : ", ") << "\"" << name << "\": " << gauge->get();
+            first = false;
+        }
+
+        out << "}, \"histograms\": {";
+        first = true;
+        for (const auto &[name, histogram] : histograms) {
+            const auto &upperBounds = histogram->getUpperBounds();
+            auto counts = histogram->getBucketCounts();
+            out << (first ? "" : ", ") << "\"" << name << "\": {\"count\": " << histogram->getCount()
+                << ", \"sum\": " << histogram->getSum() << ", \"buckets\": [";
+            for (size_t i = 0; i < counts.size(); i++) {
+                out << (i == 0 ? "" : ", ") << "{\"le\": ";
+                if (i < upperBounds.size()) {
+                    out << upperBounds[i];
+                } else {
+                    out << "\"+Inf\"";
+                }
+                out << ", \"count\": " << counts[i] << "}";
+            }
+            out << "]}";
+            first = false;
+        }
+        out << "}}";
+    }
+
+    std::string LotMetrics::toJson() const {
+        std::ostringstream out;
+        writeJson(out);
+        return out.str();
+    }
+} // namespace lot
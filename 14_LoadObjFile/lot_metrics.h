@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace lot {
+    // 단조 증가 값 (프레임 수, 업로드 바이트 등)
+    class LotCounter {
+        public:
+            void add(uint64_t amount = 1) { value.fetch_add(amount, std::memory_order_relaxed); }
+            uint64_t get() const { return value.load(std::memory_order_relaxed); }
+
+        private:
+            std::atomic<uint64_t> value{0};
+    };
+
+    // 마지막으로 설정한 값 (FPS, 메모리 사용량 등)
+    class LotGauge {
+        public:
+            void set(double newValue) { value.store(newValue, std::memory_order_relaxed); }
+            void add(double amount) {
+                double current = value.load(std::memory_order_relaxed);
+                while (!value.compare_exchange_weak(current, current + amount, std::memory_order_relaxed)) {
+                }
+            }
+            double get() const { return value.load(std::memory_order_relaxed); }
+
+        private:
+            std::atomic<double> value{0.0};
+    };
+
+    // 고정 상한 버킷 히스토그램 (마지막 버킷은 +Inf)
+    class LotHistogram {
+        public:
+            explicit LotHistogram(std::vector<double> upperBounds);
+
+            void observe(double value);
+
+            const std::vector<double> &getUpperBounds() const { return upperBounds; }
+            // 누적이 아닌 버킷별 개수 (upperBounds.size() + 1개)
+            std::vector<uint64_t> getBucketCounts() const;
+            uint64_t getCount() const { return count.load(std::memory_order_relaxed); }
+            double getSum() const { return sum.load(std::memory_order_relaxed); }
+
+        private:
+            std::vector<double> upperBounds;
+            std::unique_ptr<std::atomic<uint64_t>[]> bucketCounts;
+            std::atomic<uint64_t> count{0};
+            std::atomic<double> sum{0.0};
+    };
+
+    // 이름으로 등록하는 프로세스 전역 지표 레지스트리
+    // - 등록/내보내기만 잠금을 잡고, 반환된 참조로 하는 갱신은 잠금 없는 원자 연산
+    // - 같은 이름으로 다시 등록하면 기존 지표를 반환 (종류가 다르면 예외)
+    // - 핫 패스에서는 참조를 한 번 받아 보관해 두고 사용
+    class LotMetrics {
+        public:
+            static LotMetrics &instance();
+
+            LotCounter &counter(const std::string &name);
+            LotGauge &gauge(const std::string &name);
+            // upperBounds는 처음 등록할 때만 사용
+            LotHistogram &histogram(const std::string &name, std::vector<double> upperBounds);
+
+            // 모든 지표의 현재 값을 JSON 객체 하나로 기록 (내보내기 스레드에서 호출)
+            void writeJson(std::ostream &out) const;
+            std::string toJson() const;
+
+        private:
+            LotMetrics();
+
+            void checkUnique(const std::string &name, const char *kind) const;
+
+            uint64_t startNs;
+            mutable std::mutex registryMutex;
+            std::map<std::string, std::unique_ptr<LotCounter>> counters;
+            std::map<std::string, std::unique_ptr<LotGauge>> gauges;
+            std::map<std::string, std::unique_ptr<LotHistogram>> histograms;
+    };
+} // namespace lot
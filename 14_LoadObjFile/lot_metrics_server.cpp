@@ -0,0 +1,232 @@
+#include "lot_metrics_server.h"
+#include "lot_log.h"
+
+// std
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+namespace lot {
+    // 종료 요청을 확인하는 간격
+    static constexpr int POLL_TIMEOUT_MS = 200;
+    // HTTP 요청 헤더를 기다리는 최대 시간/크기 (느린 클라이언트가 서버 스레드를 붙잡지 않도록)
+    static constexpr int HTTP_READ_TIMEOUT_MS = 1000;
+    static constexpr size_t MAX_HTTP_REQUEST_SIZE = 8192;
+
+    std::unique_ptr<LotMetricsServer> LotMetricsServer::createFromEnvironment() {
+        const char *socketEnv = std::getenv("LOT_METRICS_SOCKET");
+        const char *portEnv = std::getenv("LOT_METRICS_HTTP_PORT");
+        if (socketEnv == nullptr && portEnv == nullptr) {
+            return nullptr;
+        }
+        uint16_t port = portEnv != nullptr ? static_cast<uint16_t>(std::stoul(portEnv)) : 0;
+        return std::make_unique<LotMetricsServer>(LotMetrics::instance(), socketEnv != nullptr ? socketEnv : "", port);
+    }
+
+#ifdef _WIN32
+    LotMetricsServer::LotMetricsServer(LotMetrics &metrics, std::string socketPath, uint16_t httpPort)
+    : metrics{metrics}, socketPath{std::move(socketPath)}, httpPort{httpPort} {
+        LOT_LOG_WARN("[Metrics] Metrics export is only supported on POSIX platforms");
+    }
+
+    LotMetricsServer::~LotMetricsServer() {}
+
+    void LotMetricsServer::serve() {}
+    void LotMetricsServer::serveSocketClient(int) {}
+    void LotMetricsServer::serveHttpClient(int) {}
+#else
+    namespace {
+        void sendAll(int fd, const std::string &data) {
+            #ifdef MSG_NOSIGNAL
+                constexpr int SEND_FLAGS = MSG_NOSIGNAL;   // 클라이언트가 먼저 닫아도 SIGPIPE로 종료되지 않도록
+            #else
+                constexpr int SEND_FLAGS = 0;              // macOS: 소켓에 SO_NOSIGPIPE 설정
+            #endif
+            size_t sent = 0;
+            while (sent < data.size()) {
+                ssize_t result = send(fd, data.data() + sent, data.size() - sent, SEND_FLAGS);
+                if (result < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (result <= 0) {
+                    return;
+                }
+                sent += static_cast<size_t>(result);
+            }
+        }
+
+        void prepareClient(int client) {
+            #ifdef SO_NOSIGPIPE
+                int enable = 1;
+                setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+            #else
+                (void)client;
+            #endif
+        }
+
+        int createUnixListener(const std::string &path) {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            if (path.size() >= sizeof(address.sun_path)) {
+                LOT_LOG_ERROR("[Metrics] Socket path is too long: {}", path);
+                return -1;
+            }
+            std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+            int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0) {
+                return -1;
+            }
+            // 이전 실행이 남긴 소켓 파일 제거
+            unlink(path.c_str());
+            if (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || listen(fd, 8) != 0) {
+                LOT_LOG_ERROR("[Metrics] Failed to listen on {}: {}", path, std::string{std::strerror(errno)});
+                close(fd);
+                return -1;
+            }
+            return fd;
+        }
+
+        int createHttpListener(uint16_t port) {
+            int fd = socket(AF_INET, SOCK_STREAM, 0);
+            if (fd < 0) {
+                return -1;
+            }
+            int reuse = 1;
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+            // 외부에 노출하지 않도록 루프백에만 바인딩
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(port);
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            if (bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || listen(fd, 8) != 0) {
+                LOT_LOG_ERROR("[Metrics] Failed to listen on 127.0.0.1:{}: {}", port, std::string{std::strerror(errno)});
+                close(fd);
+                return -1;
+            }
+            return fd;
+        }
+    }
+
+    LotMetricsServer::LotMetricsServer(LotMetrics &metrics, std::string socketPath, uint16_t httpPort)
+    : metrics{metrics}, socketPath{std::move(socketPath)}, httpPort{httpPort} {
+        if (!this->socketPath.empty()) {
+            socketListener = createUnixListener(this->socketPath);
+        }
+        if (httpPort != 0) {
+            httpListener = createHttpListener(httpPort);
+        }
+        if (socketListener < 0 && httpListener < 0) {
+            return;
+        }
+
+        if (socketListener >= 0) {
+            LOT_LOG_INFO("[Metrics] Serving JSON on unix:{}", this->socketPath);
+        }
+        if (httpListener >= 0) {
+            LOT_LOG_INFO("[Metrics] Serving JSON on http://127.0.0.1:{}/metrics", httpPort);
+        }
+        running = true;
+        serverThread = std::thread(&LotMetricsServer::serve, this);
+    }
+
+    LotMetricsServer::~LotMetricsServer() {
+        running = false;
+        if (serverThread.joinable()) {
+            serverThread.join();
+        }
+        if (socketListener >= 0) {
+            close(socketListener);
+            unlink(socketPath.c_str());
+        }
+        if (httpListener >= 0) {
+            close(httpListener);
+        }
+    }
+
+    void LotMetricsServer::serve() {
+        while (running.load(std::memory_order_acquire)) {
+            pollfd fds[2]{};
+            nfds_t count = 0;
+            if (socketListener >= 0) {
+                fds[count++] = {socketListener, POLLIN, 0};
+            }
+            if (httpListener >= 0) {
+                fds[count++] = {httpListener, POLLIN, 0};
+            }
+            if (poll(fds, count, POLL_TIMEOUT_MS) <= 0) {
+                continue;
+            }
+
+            for (nfds_t i = 0; i < count; i++) {
+                if ((fds[i].revents & POLLIN) == 0) {
+                    continue;
+                }
+                int client = accept(fds[i].fd, nullptr, nullptr);
+                if (client < 0) {
+                    continue;
+                }
+                prepareClient(client);
+                if (fds[i].fd == socketListener) {
+                    serveSocketClient(client);
+                } else {
+                    serveHttpClient(client);
+                }
+                close(client);
+            }
+        }
+    }
+
+    void LotMetricsServer::serveSocketClient(int client) {
+        sendAll(client, metrics.toJson() + "\n");
+    }
+
+    void LotMetricsServer::serveHttpClient(int client) {
+        // 요청 줄만 필요하므로 헤더 끝까지 읽고 본문은 무시
+        std::string request;
+        char buffer[1024];
+        while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_HTTP_REQUEST_SIZE) {
+            pollfd fd{client, POLLIN, 0};
+            if (poll(&fd, 1, HTTP_READ_TIMEOUT_MS) <= 0) {
+                return;
+            }
+            ssize_t received = recv(client, buffer, sizeof(buffer), 0);
+            if (received <= 0) {
+                return;
+            }
+            request.append(buffer, static_cast<size_t>(received));
+        }
+
+        std::string status = "200 OK";
+        std::string body;
+        if (request.compare(0, 4, "GET ") != 0) {
+            status = "405 Method Not Allowed";
+        } else {
+            size_t pathEnd = request.find(' ', 4);
+            std::string path = request.substr(4, pathEnd == std::string::npos ? std::string::npos : pathEnd - 4);
+            if (path == "/metrics" || path == "/") {
+                body = metrics.toJson() + "\n";
+            } else {
+                status = "404 Not Found";
+            }
+        }
+
+        std::string response = "HTTP/1.1 " + status + "\r\n"
+                               "Content-Type: application/json\r\n"
+                               "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                               "Connection: close\r\n\r\n" + body;
+        sendAll(client, response);
+    }
+#endif
+} // namespace lot
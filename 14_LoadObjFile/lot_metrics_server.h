@@ -0,0 +1,46 @@
+#pragma once
+
+#include "lot_metrics.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace lot {
+    // LotMetrics 스냅샷을 JSON으로 내보내는 로컬 수집용 서버
+    // - Unix 도메인 소켓: 연결하면 JSON 한 개를 쓰고 닫음 (예: socat - UNIX-CONNECT:<path>)
+    // - HTTP (선택): 127.0.0.1:<port>의 GET /metrics 에 JSON으로 응답
+    // - 직렬화와 소켓 I/O는 전용 스레드에서만 하므로 프레임 루프는 원자 갱신 비용만 부담
+    // - POSIX 전용이며, 다른 플랫폼에서는 경고만 출력하고 아무것도 하지 않음
+    class LotMetricsServer {
+        public:
+            // httpPort가 0이면 HTTP 엔드포인트를 열지 않음
+            LotMetricsServer(LotMetrics &metrics, std::string socketPath, uint16_t httpPort = 0);
+            ~LotMetricsServer();
+
+            LotMetricsServer(const LotMetricsServer &) = delete;
+            LotMetricsServer &operator=(const LotMetricsServer &) = delete;
+
+            // LOT_METRICS_SOCKET(소켓 경로)과 LOT_METRICS_HTTP_PORT 환경 변수로 생성
+            // 둘 다 없으면 nullptr
+            static std::unique_ptr<LotMetricsServer> createFromEnvironment();
+
+            bool isRunning() const { return serverThread.joinable(); }
+
+        private:
+            void serve();
+            void serveSocketClient(int client);
+            void serveHttpClient(int client);
+
+            LotMetrics &metrics;
+            std::string socketPath;
+            uint16_t httpPort;
+
+            int socketListener = -1;
+            int httpListener = -1;
+            std::atomic<bool> running{false};
+            std::thread serverThread;
+    };
+} // namespace lot
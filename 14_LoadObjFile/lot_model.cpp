@@ -1,27 +1,8 @@
 #include "lot_model.h"
-#include "lot_utils.h"
-
-// libs
-#define TINYOBJLOADER_IMPLEMENTATION
-#include <tinyobjloader/tiny_obj_loader.h>
-#define GLM_ENABLE_EXPERIMENTAL
-#include <glm/gtx/hash.hpp>
 
 // stds
 #include <cassert>
 #include <cstring>
-#include <unordered_map>
-
-namespace std {
-    template <>
-    struct hash<lot::LotModel::Vertex> {
-        size_t operator()(lot::LotModel::Vertex const &vertex) const {
-            size_t seed = 0;
-            lot::hashCombine(seed, vertex.position, vertex.color, vertex.normal, vertex.uv);
-            return seed;
-        }
-    };
-}
 
 namespace lot {
     LotModel::LotModel(LotDevice &device, const LotModel::Builder &builder)
@@ -31,12 +12,12 @@ namespace lot {
     }
 
     LotModel::~LotModel() {
-        vkDestroyBuffer(lotDevice.device(), vertexBuffer, nullptr);
-        vkFreeMemory(lotDevice.device(), vertexBufferMemory, nullptr);
+        // 마지막 참조가 어느 스레드에서 풀리든 이미 제출된 프레임이 이 버퍼를 읽고 있을 수 있으므로 지연 파괴
+        auto& deletionQueue = lotDevice.deletionQueue();
+        deletionQueue.destroyBuffer(vertexBuffer, vertexBufferMemory);
 
         if (hasIndexBuffer) {
-            vkDestroyBuffer(lotDevice.device(), indexBuffer, nullptr);
-            vkFreeMemory(lotDevice.device(), indexBufferMemory, nullptr);
+            deletionQueue.destroyBuffer(indexBuffer, indexBufferMemory);
         }
     }
 
@@ -91,7 +72,7 @@ namespace lot {
         lotDevice.copyBuffer(stagingBuffer, vertexBuffer, bufferSize);
 
         vkDestroyBuffer(lotDevice.device(), stagingBuffer, nullptr);
-        vkFreeMemory(lotDevice.device(), stagingBufferMemory, nullptr);
+        lotDevice.freeMemory(stagingBufferMemory);
     }
 
     void LotModel::createIndexBuffers(const std::vector<uint32_t> &indices) {
@@ -125,72 +106,11 @@ namespace lot {
         lotDevice.copyBuffer(stagingBuffer, indexBuffer, bufferSize);
 
         vkDestroyBuffer(lotDevice.device(), stagingBuffer, nullptr);
-        vkFreeMemory(lotDevice.device(), stagingBufferMemory, nullptr);
-    }
-
-    void LotModel::Builder::loadModel(const std::string &filepath) {
-        tinyobj::attrib_t attrib;
-        std::vector<tinyobj::shape_t> shapes;
-        std::vector<tinyobj::material_t> materials;
-        std::string warn, err;
-
-        if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, filepath.c_str())) {
-            throw std::runtime_error(warn + err);
-        }
-
-        vertices.clear();
-        indices.clear();
-
-        std::unordered_map<Vertex, uint32_t> uniqueVertices{};
-        for (const auto &shape : shapes) {
-            for (const auto &index : shape.mesh.indices) {
-                Vertex vertex{};
-
-                if (index.normal_index >= 0) {
-                    vertex.position = {
-                        attrib.vertices[3 * index.vertex_index + 0],
-                        attrib.vertices[3 * index.vertex_index + 1],
-                        attrib.vertices[3 * index.vertex_index + 2]
-                    };
-
-                    auto colorIndex = 3 * index.vertex_index + 2;
-                    if (colorIndex < attrib.colors.size()) {
-                        vertex.color = {
-                            attrib.colors[colorIndex - 2],
-                            attrib.colors[colorIndex - 1],
-                            attrib.colors[colorIndex - 0]
-                        };
-                    } else {
-                        vertex.color = {1.f, 1.f, 1.f};
-                    }
-                }
-                
-                if (index.normal_index >= 0) {
-                    vertex.normal = {
-                        attrib.normals[3 * index.normal_index + 0],
-                        attrib.normals[3 * index.normal_index + 1],
-                        attrib.normals[3 * index.normal_index + 2]
-                    };
-                }
-
-                if (index.texcoord_index >= 0) {
-                    vertex.uv = {
-                        attrib.texcoords[2 * index.texcoord_index + 0],
-                        attrib.texcoords[2 * index.texcoord_index + 1],
-                    };
-                }
-
-                if (uniqueVertices.count(vertex) == 0) {
-                    uniqueVertices[vertex] = static_cast<uint32_t>(vertices.size());
-                    vertices.push_back(vertex);
-                }
-                indices.push_back(uniqueVertices[vertex]);
-            }
-        }
+        lotDevice.freeMemory(stagingBufferMemory);
     }
 
-    std::vector<VkVertexInputBindingDescription> LotModel::Vertex::getBindingDescriptions() {
-        std::vector<VkVertexInputBindingDescription> bindingDescriptions(1);
+    std::array<VkVertexInputBindingDescription, 1> LotModel::Vertex::getBindingDescriptions() {
+        std::array<VkVertexInputBindingDescription, 1> bindingDescriptions{};
         bindingDescriptions[0].binding = 0;
         bindingDescriptions[0].stride = sizeof(Vertex);
         bindingDescriptions[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
@@ -198,8 +118,8 @@ namespace lot {
         return bindingDescriptions;
     }
     
-    std::vector<VkVertexInputAttributeDescription> LotModel::Vertex::getAttributeDescriptions() {
-        std::vector<VkVertexInputAttributeDescription> attributeDescriptions(2);
+    std::array<VkVertexInputAttributeDescription, 2> LotModel::Vertex::getAttributeDescriptions() {
+        std::array<VkVertexInputAttributeDescription, 2> attributeDescriptions{};
         attributeDescriptions[0].binding = 0;
         attributeDescriptions[0].location = 0;
         attributeDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
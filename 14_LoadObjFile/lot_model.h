@@ -1,11 +1,15 @@
 #pragma once
 
 #include "lot_device.h"
+#include "lot_utils.h"
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 #include <glm/glm.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/hash.hpp>
 
+#include <array>
 #include <memory>
 #include <vector>
 #include <cstring>
@@ -20,8 +24,9 @@ namespace lot {
                 glm::vec3 normal{};
                 glm::vec2 uv{};
 
-                static std::vector<VkVertexInputBindingDescription> getBindingDescriptions();
-                static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions();
+                // 버텍스 형식은 고정이므로 힙 할당 없이 고정 크기 배열로 반환
+                static std::array<VkVertexInputBindingDescription, 1> getBindingDescriptions();
+                static std::array<VkVertexInputAttributeDescription, 2> getAttributeDescriptions();
 
                 bool operator==(const Vertex& other) const {
                     return position == other.position && 
@@ -34,6 +39,7 @@ namespace lot {
             struct Builder {
                 std::vector<Vertex> vertices;
                 std::vector<uint32_t> indices{};
+                // OBJ를 읽어 같은 버텍스를 하나로 합침 (lot_model_builder.cpp)
                 void loadModel(const std::string& filepath);
             };
             
@@ -54,6 +60,7 @@ namespace lot {
             const std::vector<Vertex>& getVertices() const { return vertices; }
             const std::vector<uint32_t>& getIndices() const { return indices; }
             bool hasIndices() const { return hasIndexBuffer; }
+            uint32_t getTriangleCount() const { return (hasIndexBuffer ? indexCount : vertexCount) / 3; }
 
         private:
             void createVertexBuffers(const std::vector<Vertex> &vertices);
@@ -74,4 +81,15 @@ namespace lot {
             std::vector<Vertex> vertices;
             std::vector<uint32_t> indices;
     };
+}
+
+namespace std {
+    template <>
+    struct hash<lot::LotModel::Vertex> {
+        size_t operator()(lot::LotModel::Vertex const &vertex) const {
+            size_t seed = 0;
+            lot::hashCombine(seed, vertex.position, vertex.color, vertex.normal, vertex.uv);
+            return seed;
+        }
+    };
 }
\ No newline at end of file
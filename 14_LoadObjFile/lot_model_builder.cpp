@@ -0,0 +1,131 @@
+#include "lot_model.h"
+#include "lot_job_system.h"
+
+// libs
+#define TINYOBJLOADER_IMPLEMENTATION
+#include <tinyobjloader/tiny_obj_loader.h>
+
+// stds
+#include <stdexcept>
+#include <unordered_map>
+
+// OBJ 파싱/버텍스 용접은 디바이스가 필요 없으므로 lot_model.cpp와 분리 (lot_bench에서도 링크)
+namespace lot {
+    // 버텍스 용접 시 잡 하나가 처리하는 최소 코너 수
+    static constexpr size_t WELD_GRAIN_SIZE = 4096;
+
+    void LotModel::Builder::loadModel(const std::string &filepath) {
+        tinyobj::attrib_t attrib;
+        std::vector<tinyobj::shape_t> shapes;
+        std::vector<tinyobj::material_t> materials;
+        std::string warn, err;
+
+        if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, filepath.c_str())) {
+            throw std::runtime_error(warn + err);
+        }
+
+        vertices.clear();
+        indices.clear();
+
+        // 모든 shape의 인덱스를 하나로 펼쳐서 병렬 처리
+        std::vector<tinyobj::index_t> objIndices;
+        for (const auto &shape : shapes) {
+            objIndices.insert(objIndices.end(), shape.mesh.indices.begin(), shape.mesh.indices.end());
+        }
+        const size_t cornerCount = objIndices.size();
+
+        auto &jobSystem = LotJobSystem::instance();
+
+        // 1단계: 코너(인덱스)마다 버텍스를 만들고 해시를 미리 계산
+        std::vector<Vertex> corners(cornerCount);
+        std::vector<size_t> cornerHashes(cornerCount);
+        jobSystem.parallelFor(cornerCount, WELD_GRAIN_SIZE, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const auto &index = objIndices[i];
+                Vertex vertex{};
+
+                if (index.normal_index >= 0) {
+                    vertex.position = {
+                        attrib.vertices[3 * index.vertex_index + 0],
+                        attrib.vertices[3 * index.vertex_index + 1],
+                        attrib.vertices[3 * index.vertex_index + 2]
+                    };
+
+                    auto colorIndex = 3 * index.vertex_index + 2;
+                    if (colorIndex < attrib.colors.size()) {
+                        vertex.color = {
+                            attrib.colors[colorIndex - 2],
+                            attrib.colors[colorIndex - 1],
+                            attrib.colors[colorIndex - 0]
+                        };
+                    } else {
+                        vertex.color = {1.f, 1.f, 1.f};
+                    }
+                }
+                
+                if (index.normal_index >= 0) {
+                    vertex.normal = {
+                        attrib.normals[3 * index.normal_index + 0],
+                        attrib.normals[3 * index.normal_index + 1],
+                        attrib.normals[3 * index.normal_index + 2]
+                    };
+                }
+
+                if (index.texcoord_index >= 0) {
+                    vertex.uv = {
+                        attrib.texcoords[2 * index.texcoord_index + 0],
+                        attrib.texcoords[2 * index.texcoord_index + 1],
+                    };
+                }
+
+                corners[i] = vertex;
+                cornerHashes[i] = std::hash<Vertex>{}(vertex);
+            }
+        });
+
+        // 2단계: 해시 값으로 샤드를 나눠 각 코너가 처음 등장한 코너 위치를 찾음
+        // 같은 버텍스는 항상 같은 샤드에 들어가므로 샤드끼리 잠금이 필요 없음
+        std::vector<uint32_t> firstOccurrence(cornerCount);
+        const size_t shardCount = cornerCount < WELD_GRAIN_SIZE ? 1 : jobSystem.getWorkerCount() + 1;
+
+        // 코너 번호를 샤드별로 한 번만 나눠 둠 (계수 정렬: 샤드 안에서는 코너 순서 유지)
+        // 각 샤드는 자기 코너만 순회하므로 전체 순회량은 샤드 수와 무관하게 O(N)
+        std::vector<size_t> shardOffsets(shardCount + 1, 0);
+        for (size_t i = 0; i < cornerCount; i++) {
+            shardOffsets[cornerHashes[i] % shardCount + 1]++;
+        }
+        for (size_t shard = 0; shard < shardCount; shard++) {
+            shardOffsets[shard + 1] += shardOffsets[shard];
+        }
+        std::vector<uint32_t> shardCorners(cornerCount);
+        {
+            std::vector<size_t> cursors(shardOffsets.begin(), shardOffsets.end() - 1);
+            for (size_t i = 0; i < cornerCount; i++) {
+                shardCorners[cursors[cornerHashes[i] % shardCount]++] = static_cast<uint32_t>(i);
+            }
+        }
+
+        jobSystem.parallelFor(shardCount, 1, [&](size_t shardBegin, size_t shardEnd) {
+            for (size_t shard = shardBegin; shard < shardEnd; shard++) {
+                std::unordered_map<Vertex, uint32_t> uniqueCorners{};
+                uniqueCorners.reserve(shardOffsets[shard + 1] - shardOffsets[shard]);
+                for (size_t j = shardOffsets[shard]; j < shardOffsets[shard + 1]; j++) {
+                    uint32_t i = shardCorners[j];
+                    auto result = uniqueCorners.emplace(corners[i], i);
+                    firstOccurrence[i] = result.first->second;
+                }
+            }
+        });
+
+        // 3단계: 등장 순서대로 압축 (직렬 버전과 동일한 버텍스/인덱스 순서 유지)
+        std::vector<uint32_t> cornerToVertex(cornerCount);
+        indices.resize(cornerCount);
+        for (size_t i = 0; i < cornerCount; i++) {
+            if (firstOccurrence[i] == i) {
+                cornerToVertex[i] = static_cast<uint32_t>(vertices.size());
+                vertices.push_back(corners[i]);
+            }
+            indices[i] = cornerToVertex[firstOccurrence[i]];
+        }
+    }
+} // namespace lot
@@ -0,0 +1,228 @@
+#include "lot_offscreen_target.h"
+#include "lot_cpu_profiler.h"
+#include "lot_flight_recorder.h"
+
+#include <array>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+namespace lot {
+    LotOffscreenTarget::LotOffscreenTarget(LotDevice &deviceRef, VkExtent2D extent, uint32_t frameCount)
+    : device{deviceRef}, extent{extent}, frames(frameCount) {
+        if (extent.width == 0 || extent.height == 0 || frameCount == 0) {
+            throw std::runtime_error("invalid offscreen target extent or frame count!");
+        }
+        depthFormat = device.findSupportedFormat(
+            {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
+            VK_IMAGE_TILING_OPTIMAL,
+            VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT);
+
+        createRenderPass();
+        createAttachments();
+        createFramebuffers();
+        createSyncObjects();
+    }
+
+    LotOffscreenTarget::~LotOffscreenTarget() {
+        {
+            std::lock_guard<std::mutex> lock{device.queueMutex()};
+            vkDeviceWaitIdle(device.device());
+        }
+
+        for (auto &frame : frames) {
+            vkDestroyFramebuffer(device.device(), frame.framebuffer, nullptr);
+            vkDestroyImageView(device.device(), frame.colorImageView, nullptr);
+            vkDestroyImage(device.device(), frame.colorImage, nullptr);
+            device.freeMemory(frame.colorImageMemory);
+            vkDestroyImageView(device.device(), frame.depthImageView, nullptr);
+            vkDestroyImage(device.device(), frame.depthImage, nullptr);
+            device.freeMemory(frame.depthImageMemory);
+            vkDestroyFence(device.device(), frame.inFlightFence, nullptr);
+        }
+        frames.clear();
+
+        vkDestroyRenderPass(device.device(), renderPass, nullptr);
+    }
+
+    VkResult LotOffscreenTarget::acquireNextImage(uint32_t *imageIndex) {
+        LOT_PROFILE_SCOPE("waitForFrameFence");
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::WaitForFences);
+        VkResult result = vkWaitForFences(device.device(), 1, &frames[currentFrame].inFlightFence, VK_TRUE,
+                                          std::numeric_limits<uint64_t>::max());
+        *imageIndex = currentFrame;
+        return result;
+    }
+
+    VkResult LotOffscreenTarget::submitCommandBuffers(const VkCommandBuffer *buffers, uint32_t *imageIndex) {
+        LOT_PROFILE_SCOPE("LotOffscreenTarget::submitCommandBuffers");
+        VkFence fence = frames[*imageIndex].inFlightFence;
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = buffers;
+
+        VkResult result;
+        {
+            // 메인 스레드의 업로드(endSingleTimeCommands)와 같은 큐를 공유
+            std::lock_guard<std::mutex> lock{device.queueMutex()};
+            vkResetFences(device.device(), 1, &fence);
+            LotFlightRecorder::countVulkanCall(LotVulkanCall::QueueSubmit);
+            result = vkQueueSubmit(device.graphicsQueue(), 1, &submitInfo, fence);
+        }
+
+        currentFrame = (currentFrame + 1) % static_cast<uint32_t>(frames.size());
+        return result;
+    }
+
+    void LotOffscreenTarget::createRenderPass() {
+        VkAttachmentDescription depthAttachment{};
+        depthAttachment.format = depthFormat;
+        depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentReference depthAttachmentRef{};
+        depthAttachmentRef.attachment = 1;
+        depthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        // 프레젠트 대신 결과를 복사해 갈 수 있도록 TRANSFER_SRC로 끝냄
+        VkAttachmentDescription colorAttachment = {};
+        colorAttachment.format = COLOR_FORMAT;
+        colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        colorAttachment.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+        VkAttachmentReference colorAttachmentRef = {};
+        colorAttachmentRef.attachment = 0;
+        colorAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments = &colorAttachmentRef;
+        subpass.pDepthStencilAttachment = &depthAttachmentRef;
+
+        std::array<VkSubpassDependency, 2> dependencies{};
+        dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[0].srcAccessMask = 0;
+        dependencies[0].srcStageMask =
+            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+        dependencies[0].dstSubpass = 0;
+        dependencies[0].dstStageMask =
+            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+        dependencies[0].dstAccessMask =
+            VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+        // 렌더 패스 이후의 복사가 컬러 쓰기를 기다리도록 함
+        dependencies[1].srcSubpass = 0;
+        dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[1].dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dependencies[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+        std::array<VkAttachmentDescription, 2> attachments = { colorAttachment, depthAttachment };
+        VkRenderPassCreateInfo renderPassInfo = {};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+        renderPassInfo.pAttachments = attachments.data();
+        renderPassInfo.subpassCount = 1;
+        renderPassInfo.pSubpasses = &subpass;
+        renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
+        renderPassInfo.pDependencies = dependencies.data();
+
+        if (vkCreateRenderPass(device.device(), &renderPassInfo, nullptr, &renderPass) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create offscreen render pass!");
+        }
+    }
+
+    void LotOffscreenTarget::createAttachments() {
+        for (auto &frame : frames) {
+            createImage(COLOR_FORMAT,
+                        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                        VK_IMAGE_ASPECT_COLOR_BIT,
+                        frame.colorImage, frame.colorImageMemory, frame.colorImageView);
+            createImage(depthFormat,
+                        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                        VK_IMAGE_ASPECT_DEPTH_BIT,
+                        frame.depthImage, frame.depthImageMemory, frame.depthImageView);
+        }
+    }
+
+    void LotOffscreenTarget::createImage(VkFormat format, VkImageUsageFlags usage, VkImageAspectFlags aspect,
+                                         VkImage &image, VkDeviceMemory &imageMemory, VkImageView &imageView) {
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent.width = extent.width;
+        imageInfo.extent.height = extent.height;
+        imageInfo.extent.depth = 1;
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = format;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = usage;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.flags = 0;
+
+        device.createImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, image, imageMemory);
+
+        VkImageViewCreateInfo viewInfo{};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = format;
+        viewInfo.subresourceRange.aspectMask = aspect;
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+
+        if (vkCreateImageView(device.device(), &viewInfo, nullptr, &imageView) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create offscreen image view!");
+        }
+    }
+
+    void LotOffscreenTarget::createFramebuffers() {
+        for (auto &frame : frames) {
+            std::array<VkImageView, 2> attachments = { frame.colorImageView, frame.depthImageView };
+
+            VkFramebufferCreateInfo framebufferInfo = {};
+            framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+            framebufferInfo.renderPass = renderPass;
+            framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+            framebufferInfo.pAttachments = attachments.data();
+            framebufferInfo.width = extent.width;
+            framebufferInfo.height = extent.height;
+            framebufferInfo.layers = 1;
+
+            if (vkCreateFramebuffer(device.device(), &framebufferInfo, nullptr, &frame.framebuffer) != VK_SUCCESS) {
+                throw std::runtime_error("failed to create offscreen framebuffer!");
+            }
+        }
+    }
+
+    void LotOffscreenTarget::createSyncObjects() {
+        VkFenceCreateInfo fenceInfo = {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+        for (auto &frame : frames) {
+            if (vkCreateFence(device.device(), &fenceInfo, nullptr, &frame.inFlightFence) != VK_SUCCESS) {
+                throw std::runtime_error("failed to create synchronization objects for a frame!");
+            }
+        }
+    }
+} // namespace lot
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "lot_device.h"
+
+// Vulkan header
+#include "vulkan/vulkan.h"
+
+#include <vector>
+
+namespace lot {
+    // 창/서피스 없이 렌더링하기 위한 오프스크린 렌더 타깃 (헤드리스 벤치마크, CI용)
+    // - 스왑체인과 같은 구성의 렌더 패스(컬러 + 깊이)와 프레임 슬롯별 이미지/프레임버퍼를 가짐
+    // - 프레젠트가 없으므로 세마포어 없이 슬롯별 펜스로만 동기화하고, 이미지 인덱스 = 프레임 슬롯
+    class LotOffscreenTarget {
+        public:
+            static constexpr VkFormat COLOR_FORMAT = VK_FORMAT_R8G8B8A8_UNORM;
+
+            LotOffscreenTarget(LotDevice &deviceRef, VkExtent2D extent, uint32_t frameCount);
+            ~LotOffscreenTarget();
+
+            LotOffscreenTarget(const LotOffscreenTarget &) = delete;
+            LotOffscreenTarget& operator=(const LotOffscreenTarget &) = delete;
+
+            VkFramebuffer getFrameBuffer(int index) const { return frames[index].framebuffer; }
+            VkRenderPass getRenderPass() const { return renderPass; }
+            // 렌더 패스가 끝나면 TRANSFER_SRC_OPTIMAL 레이아웃 (결과 회수용)
+            VkImage getColorImage(int index) const { return frames[index].colorImage; }
+            size_t imageCount() const { return frames.size(); }
+            VkFormat getColorFormat() const { return COLOR_FORMAT; }
+            VkFormat getDepthFormat() const { return depthFormat; }
+            VkExtent2D getExtent() const { return extent; }
+
+            float extentAspectRatio() const {
+                return static_cast<float>(extent.width) / static_cast<float>(extent.height);
+            }
+
+            // 다음 프레임 슬롯의 이전 제출이 끝날 때까지 대기 후 그 슬롯을 이미지 인덱스로 반환
+            VkResult acquireNextImage(uint32_t *imageIndex);
+            VkResult submitCommandBuffers(const VkCommandBuffer *buffers, uint32_t *imageIndex);
+
+        private:
+            struct FrameResources {
+                VkImage colorImage = VK_NULL_HANDLE;
+                VkDeviceMemory colorImageMemory = VK_NULL_HANDLE;
+                VkImageView colorImageView = VK_NULL_HANDLE;
+                VkImage depthImage = VK_NULL_HANDLE;
+                VkDeviceMemory depthImageMemory = VK_NULL_HANDLE;
+                VkImageView depthImageView = VK_NULL_HANDLE;
+                VkFramebuffer framebuffer = VK_NULL_HANDLE;
+                VkFence inFlightFence = VK_NULL_HANDLE;
+            };
+
+            void createRenderPass();
+            void createAttachments();
+            void createFramebuffers();
+            void createSyncObjects();
+
+            void createImage(VkFormat format, VkImageUsageFlags usage, VkImageAspectFlags aspect,
+                             VkImage &image, VkDeviceMemory &imageMemory, VkImageView &imageView);
+
+            LotDevice &device;
+            VkExtent2D extent;
+            VkFormat depthFormat;
+            VkRenderPass renderPass = VK_NULL_HANDLE;
+
+            std::vector<FrameResources> frames;
+            uint32_t currentFrame = 0;
+    };
+} // namespace lot
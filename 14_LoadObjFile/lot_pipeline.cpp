@@ -1,9 +1,9 @@
 #include "lot_pipeline.h"
 
+#include "lot_flight_recorder.h"
 #include "lot_model.h"
 
 #include <cassert>
-#include <fstream>
 #include <stdexcept>
 #include <iostream>
 
@@ -12,13 +12,20 @@ namespace lot {
                              const std::string& vertFilepath, const std::string& fragFilepath, 
                              const PipelineConfigInfo& configInfo) 
     : lotDevice(device) {
-        createGraphicsPipeline(vertFilepath, fragFilepath, configInfo);
+        auto vertShader = lotDevice.getShaderLibrary().load(vertFilepath);
+        auto fragShader = lotDevice.getShaderLibrary().load(fragFilepath);
+        createGraphicsPipeline(vertShader->getShaderModule(), fragShader->getShaderModule(), configInfo);
+    }
+
+    LotPipeline::LotPipeline(LotDevice& device,
+                             const LotShaderModule& vertShader, const LotShaderModule& fragShader,
+                             const PipelineConfigInfo& configInfo)
+    : lotDevice(device) {
+        createGraphicsPipeline(vertShader.getShaderModule(), fragShader.getShaderModule(), configInfo);
     }
 
     LotPipeline::~LotPipeline() {
-        vkDestroyShaderModule(lotDevice.device(), vertShaderModule, nullptr);
-        vkDestroyShaderModule(lotDevice.device(), fragShaderModule, nullptr);
-        vkDestroyPipeline(lotDevice.device(), graphicsPipeline, nullptr);
+        lotDevice.deletionQueue().destroyPipeline(graphicsPipeline);
     }
 
     void LotPipeline::bind(VkCommandBuffer commandBuffer) {
@@ -94,36 +101,34 @@ namespace lot {
         configInfo.dynamicStateInfo.flags = 0;
     }
 
-    std::vector<char> LotPipeline::readFile(const std::string& filepath) {
-        std::ifstream file {filepath, std::ios::ate | std::ios::binary};
-
-        if (!file.is_open()) {
-            throw std::runtime_error("failed to open file : " + filepath);
-        }
-
-        size_t fileSize = static_cast<size_t>(file.tellg());
-        std::vector<char> buffer(fileSize);
-
-        file.seekg(0);
-        file.read(buffer.data(), fileSize);
-
-        file.close();
-        return buffer;
+    void LotPipeline::copyPipelineConfigInfo(const PipelineConfigInfo& src, PipelineConfigInfo& dst) {
+        dst.viewportInfo = src.viewportInfo;
+        dst.inputAssemblyInfo = src.inputAssemblyInfo;
+        dst.rasterizationInfo = src.rasterizationInfo;
+        dst.multisampleInfo = src.multisampleInfo;
+        dst.colorBlendAttachment = src.colorBlendAttachment;
+        dst.colorBlendInfo = src.colorBlendInfo;
+        dst.depthStencilInfo = src.depthStencilInfo;
+        dst.dynamicStateEnables = src.dynamicStateEnables;
+        dst.dynamicStateInfo = src.dynamicStateInfo;
+        dst.pipelineLayout = src.pipelineLayout;
+        dst.renderPass = src.renderPass;
+        dst.subpass = src.subpass;
+        dst.specializationEntries = src.specializationEntries;
+        dst.specializationData = src.specializationData;
+
+        dst.colorBlendInfo.pAttachments = &dst.colorBlendAttachment;
+        dst.dynamicStateInfo.pDynamicStates = dst.dynamicStateEnables.data();
+        dst.dynamicStateInfo.dynamicStateCount = static_cast<uint32_t>(dst.dynamicStateEnables.size());
     }
 
-    void LotPipeline::createGraphicsPipeline(const std::string& vertFilepath, const std::string& fragFilepath,
+    void LotPipeline::createGraphicsPipeline(VkShaderModule vertShaderModule, VkShaderModule fragShaderModule,
                                              const PipelineConfigInfo& configInfo) {
         assert(configInfo.pipelineLayout != VK_NULL_HANDLE &&
                "Cannot create graphics pipeline : no pipelineLayout provided in configInfo");
         assert(configInfo.renderPass != VK_NULL_HANDLE &&
                "Cannot create graphics pipeline : no renderpass provided in configInfo");
 
-        auto vertCode = readFile(vertFilepath);
-        auto fragCode = readFile(fragFilepath);
-
-        createShaderModule(vertCode, &vertShaderModule);
-        createShaderModule(fragCode, &fragShaderModule);
-
         VkPipelineShaderStageCreateInfo shaderStages[2];
         shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
         shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
@@ -141,6 +146,16 @@ namespace lot {
         shaderStages[1].pNext = nullptr;
         shaderStages[1].pSpecializationInfo = nullptr;
 
+        VkSpecializationInfo specializationInfo{};
+        if (!configInfo.specializationEntries.empty()) {
+            specializationInfo.mapEntryCount = static_cast<uint32_t>(configInfo.specializationEntries.size());
+            specializationInfo.pMapEntries = configInfo.specializationEntries.data();
+            specializationInfo.dataSize = configInfo.specializationData.size();
+            specializationInfo.pData = configInfo.specializationData.data();
+            shaderStages[0].pSpecializationInfo = &specializationInfo;
+            shaderStages[1].pSpecializationInfo = &specializationInfo;
+        }
+
         auto bindingDescriptions = LotModel::Vertex::getBindingDescriptions();
         auto attributeDescriptions = LotModel::Vertex::getAttributeDescriptions();
         VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
@@ -170,19 +185,10 @@ namespace lot {
         pipelineInfo.basePipelineIndex = -1;
         pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 
-        if (vkCreateGraphicsPipelines(lotDevice.device(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &graphicsPipeline) != VK_SUCCESS) {
+        // 디바이스가 소유한 디스크 캐시를 공유하여 두 번째 실행부터는 컴파일을 건너뜀
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::CreateGraphicsPipelines);
+        if (vkCreateGraphicsPipelines(lotDevice.device(), lotDevice.pipelineCache(), 1, &pipelineInfo, nullptr, &graphicsPipeline) != VK_SUCCESS) {
             throw std::runtime_error("failed to create graphics pipeline");
         }
     }
-
-    void LotPipeline::createShaderModule(const std::vector<char>& code, VkShaderModule* shaderModule) {
-        VkShaderModuleCreateInfo createInfo{};
-        createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        createInfo.codeSize = code.size();
-        createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
-
-        if (vkCreateShaderModule(lotDevice.device(), &createInfo, nullptr, shaderModule) != VK_SUCCESS) {
-            throw std::runtime_error("failed to create shader module");
-        }
-    }
 } // namespace lot
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "lot_device.h"
 
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -23,6 +25,23 @@ namespace lot {
         VkPipelineLayout pipelineLayout = nullptr;
         VkRenderPass renderPass = nullptr;
         uint32_t subpass = 0;
+
+        // 특수화 상수 (버텍스/프래그먼트 스테이지에 공통 적용, 비어 있으면 사용하지 않음)
+        std::vector<VkSpecializationMapEntry> specializationEntries;
+        std::vector<uint8_t> specializationData;
+
+        // bool 상수는 VkBool32로 넘길 것
+        template <typename T>
+        void setSpecializationConstant(uint32_t constantID, const T& value) {
+            VkSpecializationMapEntry entry{};
+            entry.constantID = constantID;
+            entry.offset = static_cast<uint32_t>(specializationData.size());
+            entry.size = sizeof(T);
+            specializationEntries.push_back(entry);
+
+            specializationData.resize(specializationData.size() + sizeof(T));
+            std::memcpy(specializationData.data() + entry.offset, &value, sizeof(T));
+        }
     };
 
     class LotPipeline {
@@ -30,6 +49,10 @@ namespace lot {
             LotPipeline(LotDevice& device, 
                         const std::string& vertFilepath, const std::string& fragFilepath, 
                         const PipelineConfigInfo& configInfo);
+            // 이미 로드한 셰이더 모듈로 생성 (여러 파이프라인이 같은 모듈을 공유할 때)
+            LotPipeline(LotDevice& device,
+                        const LotShaderModule& vertShader, const LotShaderModule& fragShader,
+                        const PipelineConfigInfo& configInfo);
             ~LotPipeline();
 
             LotPipeline(const LotPipeline&) = delete;
@@ -38,17 +61,15 @@ namespace lot {
             void bind(VkCommandBuffer commandBuffer);
 
             static void defaultPipelineConfigInfo(PipelineConfigInfo& configInfo);
+            // 내부 포인터(pAttachments, pDynamicStates)를 대상 구조체 기준으로 다시 연결하며 복사
+            static void copyPipelineConfigInfo(const PipelineConfigInfo& src, PipelineConfigInfo& dst);
             
         private:
-            static std::vector<char> readFile(const std::string& filepath);
-
-            void createGraphicsPipeline(const std::string& vertFilepath, const std::string& fragFilepath,
+            // 셰이더 모듈은 생성 중에만 필요하므로 파이프라인이 보관하지 않음
+            void createGraphicsPipeline(VkShaderModule vertShaderModule, VkShaderModule fragShaderModule,
                                         const PipelineConfigInfo& configInfo);
-            void createShaderModule(const std::vector<char>& code, VkShaderModule* shaderModule);
 
             LotDevice& lotDevice;
             VkPipeline graphicsPipeline;
-            VkShaderModule vertShaderModule;
-            VkShaderModule fragShaderModule;
     };
 } // namespace lot
\ No newline at end of file
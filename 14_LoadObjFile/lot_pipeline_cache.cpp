@@ -0,0 +1,129 @@
+#include "lot_pipeline_cache.h"
+#include "lot_log.h"
+
+// std
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace lot {
+    namespace {
+        // VK_PIPELINE_CACHE_HEADER_VERSION_ONE 헤더 레이아웃 (Vulkan 명세 기준, 리틀 엔디언 uint32)
+        struct PipelineCacheHeader {
+            uint32_t headerSize;
+            uint32_t headerVersion;
+            uint32_t vendorID;
+            uint32_t deviceID;
+            uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+        };
+        static_assert(sizeof(PipelineCacheHeader) == 32, "unexpected pipeline cache header size");
+    }
+
+    LotPipelineCache::LotPipelineCache(VkDevice device, const VkPhysicalDeviceProperties &properties,
+                                       std::string filepath)
+    : device{device}, properties{properties}, filepath{std::move(filepath)} {
+        std::vector<char> data = readCacheFile(this->filepath);
+        if (!data.empty() && !isCompatible(data)) {
+            // 드라이버 업데이트나 GPU 교체 후의 캐시는 무시하고 새로 만듦
+            LOT_LOG_WARN("[PipelineCache] Ignoring incompatible cache: {}", this->filepath);
+            data.clear();
+        }
+
+        VkPipelineCacheCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.initialDataSize = data.size();
+        createInfo.pInitialData = data.empty() ? nullptr : data.data();
+
+        if (vkCreatePipelineCache(device, &createInfo, nullptr, &pipelineCache) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create pipeline cache!");
+        }
+
+        warm = !data.empty();
+        if (warm) {
+            LOT_LOG_INFO("[PipelineCache] Loaded {} bytes from {}", data.size(), this->filepath);
+        } else {
+            LOT_LOG_INFO("[PipelineCache] No usable cache at {}, starting cold", this->filepath);
+        }
+    }
+
+    LotPipelineCache::~LotPipelineCache() {
+        vkDestroyPipelineCache(device, pipelineCache, nullptr);
+    }
+
+    std::string LotPipelineCache::defaultFilepath() {
+        if (const char *env = std::getenv("LOT_PIPELINE_CACHE")) {
+            return env;
+        }
+        return "pipeline_cache.bin";
+    }
+
+    std::vector<char> LotPipelineCache::readCacheFile(const std::string &filepath) {
+        std::ifstream file{filepath, std::ios::ate | std::ios::binary};
+        if (!file.is_open()) {
+            return {};
+        }
+
+        size_t fileSize = static_cast<size_t>(file.tellg());
+        std::vector<char> buffer(fileSize);
+        file.seekg(0);
+        file.read(buffer.data(), fileSize);
+        if (!file) {
+            return {};
+        }
+        return buffer;
+    }
+
+    bool LotPipelineCache::isCompatible(const std::vector<char> &data) const {
+        if (data.size() < sizeof(PipelineCacheHeader)) {
+            return false;
+        }
+
+        PipelineCacheHeader header{};
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        return header.headerSize >= sizeof(PipelineCacheHeader) &&
+               header.headerSize <= data.size() &&
+               header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+               header.vendorID == properties.vendorID &&
+               header.deviceID == properties.deviceID &&
+               std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+
+    void LotPipelineCache::save() {
+        size_t dataSize = 0;
+        if (vkGetPipelineCacheData(device, pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0) {
+            return;
+        }
+
+        std::vector<char> data(dataSize);
+        if (vkGetPipelineCacheData(device, pipelineCache, &dataSize, data.data()) != VK_SUCCESS) {
+            LOT_LOG_ERROR("[PipelineCache] Failed to read pipeline cache data");
+            return;
+        }
+        data.resize(dataSize);
+
+        // 종료 경로에서 호출되므로 실패해도 예외 대신 경고만 남김
+        std::string tempFilepath = filepath + ".tmp";
+        {
+            std::ofstream file{tempFilepath, std::ios::binary | std::ios::trunc};
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+            file.flush();
+            if (!file) {
+                LOT_LOG_ERROR("[PipelineCache] Failed to write {}", tempFilepath);
+                return;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(tempFilepath, filepath, error);
+        if (error) {
+            LOT_LOG_ERROR("[PipelineCache] Failed to replace {}: {}", filepath, error.message());
+            std::filesystem::remove(tempFilepath, error);
+            return;
+        }
+        LOT_LOG_INFO("[PipelineCache] Saved {} bytes to {}", data.size(), filepath);
+    }
+} // namespace lot
@@ -0,0 +1,46 @@
+#pragma once
+
+#ifdef __APPLE__
+    #include "vulkan/vulkan_beta.h"
+#else
+    #include "vulkan/vulkan.h"
+#endif
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lot {
+    // 디스크에 저장되는 VkPipelineCache
+    // - 생성 시 파일을 읽어 헤더(vendorID, deviceID, pipelineCacheUUID)가 현재 디바이스와 맞을 때만 사용
+    // - 모든 파이프라인 생성에서 공유 (VkPipelineCache는 생성 호출에 대해 내부 동기화됨)
+    // - save()는 임시 파일에 쓴 뒤 rename으로 교체하여 중간에 종료되어도 파일이 깨지지 않음
+    class LotPipelineCache {
+        public:
+            LotPipelineCache(VkDevice device, const VkPhysicalDeviceProperties &properties, std::string filepath);
+            ~LotPipelineCache();
+
+            LotPipelineCache(const LotPipelineCache &) = delete;
+            LotPipelineCache &operator=(const LotPipelineCache &) = delete;
+
+            VkPipelineCache getPipelineCache() const { return pipelineCache; }
+            // 유효한 캐시 파일을 불러왔는지 (콜드/웜 시작 구분용)
+            bool isWarm() const { return warm; }
+            const std::string &getFilepath() const { return filepath; }
+
+            void save();
+
+            // 기본 경로: LOT_PIPELINE_CACHE 환경 변수, 없으면 실행 디렉터리의 pipeline_cache.bin
+            static std::string defaultFilepath();
+
+        private:
+            static std::vector<char> readCacheFile(const std::string &filepath);
+            bool isCompatible(const std::vector<char> &data) const;
+
+            VkDevice device;
+            VkPhysicalDeviceProperties properties;
+            std::string filepath;
+            VkPipelineCache pipelineCache = VK_NULL_HANDLE;
+            bool warm = false;
+    };
+} // namespace lot
@@ -0,0 +1,343 @@
+#include "lot_pipeline_manager.h"
+#include "lot_log.h"
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <type_traits>
+
+namespace lot {
+    namespace {
+        // 키 바이트열 작성기. 포인터는 기록하지 않고 가리키는 내용을 기록함
+        class KeyWriter {
+            public:
+                explicit KeyWriter(std::vector<uint8_t> &bytes) : bytes{bytes} {}
+
+                template <typename T>
+                void add(const T &value) {
+                    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                                  "hash fields one by one to avoid padding and pointers");
+                    addBytes(&value, sizeof(T));
+                }
+
+                void addBytes(const void *data, size_t size) {
+                    const auto *begin = static_cast<const uint8_t *>(data);
+                    bytes.insert(bytes.end(), begin, begin + size);
+                }
+
+                template <typename Handle>
+                void addHandle(Handle handle) {
+                    auto value = reinterpret_cast<uint64_t>(handle);
+                    add(value);
+                }
+
+            private:
+                std::vector<uint8_t> &bytes;
+        };
+
+        // FNV-1a
+        uint64_t hashKeyBytes(const std::vector<uint8_t> &bytes) {
+            uint64_t hash = 14695981039346656037ull;
+            for (uint8_t byte : bytes) {
+                hash ^= byte;
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+    }
+
+    LotPipelineManager::LotPipelineManager(LotDevice &device, uint32_t compileThreadCount)
+    : lotDevice{device} {
+        for (uint32_t i = 0; i < compileThreadCount; i++) {
+            compileThreads.emplace_back(&LotPipelineManager::compileLoop, this);
+        }
+    }
+
+    LotPipelineManager::~LotPipelineManager() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            running = false;
+            // 아직 시작하지 않은 컴파일은 버림
+            compileQueue.clear();
+        }
+        queueCondition.notify_all();
+        for (auto &thread : compileThreads) {
+            thread.join();
+        }
+    }
+
+    uint64_t LotPipelineManager::hashPipelineConfig(const PipelineConfigInfo &configInfo,
+                                                    uint64_t vertShaderHash, uint64_t fragShaderHash) {
+        return hashKeyBytes(buildPipelineKey(configInfo, vertShaderHash, fragShaderHash));
+    }
+
+    std::vector<uint8_t> LotPipelineManager::buildPipelineKey(const PipelineConfigInfo &configInfo,
+                                                              uint64_t vertShaderHash, uint64_t fragShaderHash) {
+        std::vector<uint8_t> bytes;
+        bytes.reserve(512);
+        KeyWriter writer{bytes};
+        writer.add(vertShaderHash);
+        writer.add(fragShaderHash);
+
+        const auto &inputAssembly = configInfo.inputAssemblyInfo;
+        writer.add(inputAssembly.topology);
+        writer.add(inputAssembly.primitiveRestartEnable);
+
+        writer.add(configInfo.viewportInfo.viewportCount);
+        writer.add(configInfo.viewportInfo.scissorCount);
+
+        const auto &raster = configInfo.rasterizationInfo;
+        writer.add(raster.depthClampEnable);
+        writer.add(raster.rasterizerDiscardEnable);
+        writer.add(raster.polygonMode);
+        writer.add(raster.cullMode);
+        writer.add(raster.frontFace);
+        writer.add(raster.depthBiasEnable);
+        writer.add(raster.depthBiasConstantFactor);
+        writer.add(raster.depthBiasClamp);
+        writer.add(raster.depthBiasSlopeFactor);
+        writer.add(raster.lineWidth);
+
+        const auto &multisample = configInfo.multisampleInfo;
+        writer.add(multisample.rasterizationSamples);
+        writer.add(multisample.sampleShadingEnable);
+        writer.add(multisample.minSampleShading);
+        writer.add(multisample.alphaToCoverageEnable);
+        writer.add(multisample.alphaToOneEnable);
+
+        const auto &blend = configInfo.colorBlendAttachment;
+        writer.add(blend.blendEnable);
+        writer.add(blend.srcColorBlendFactor);
+        writer.add(blend.dstColorBlendFactor);
+        writer.add(blend.colorBlendOp);
+        writer.add(blend.srcAlphaBlendFactor);
+        writer.add(blend.dstAlphaBlendFactor);
+        writer.add(blend.alphaBlendOp);
+        writer.add(blend.colorWriteMask);
+
+        const auto &colorBlend = configInfo.colorBlendInfo;
+        writer.add(colorBlend.logicOpEnable);
+        writer.add(colorBlend.logicOp);
+        writer.add(colorBlend.attachmentCount);
+        for (float constant : colorBlend.blendConstants) {
+            writer.add(constant);
+        }
+
+        const auto &depthStencil = configInfo.depthStencilInfo;
+        writer.add(depthStencil.depthTestEnable);
+        writer.add(depthStencil.depthWriteEnable);
+        writer.add(depthStencil.depthCompareOp);
+        writer.add(depthStencil.depthBoundsTestEnable);
+        writer.add(depthStencil.stencilTestEnable);
+        for (const VkStencilOpState *op : {&depthStencil.front, &depthStencil.back}) {
+            writer.add(op->failOp);
+            writer.add(op->passOp);
+            writer.add(op->depthFailOp);
+            writer.add(op->compareOp);
+            writer.add(op->compareMask);
+            writer.add(op->writeMask);
+            writer.add(op->reference);
+        }
+        writer.add(depthStencil.minDepthBounds);
+        writer.add(depthStencil.maxDepthBounds);
+
+        for (VkDynamicState state : configInfo.dynamicStateEnables) {
+            writer.add(state);
+        }
+
+        writer.addHandle(configInfo.pipelineLayout);
+        writer.addHandle(configInfo.renderPass);
+        writer.add(configInfo.subpass);
+
+        for (const auto &entry : configInfo.specializationEntries) {
+            writer.add(entry.constantID);
+            writer.add(entry.offset);
+            writer.add(entry.size);
+        }
+        writer.addBytes(configInfo.specializationData.data(), configInfo.specializationData.size());
+
+        return bytes;
+    }
+
+    LotPipelineManager::Variant &LotPipelineManager::findOrAddVariant(
+        const std::string &vertFilepath, const std::string &fragFilepath,
+        const PipelineConfigInfo &configInfo, bool &created) {
+        // 셰이더 로드는 매핑과 해시만 하므로 호출 스레드에서 해도 저렴함
+        auto vertShader = lotDevice.getShaderLibrary().load(vertFilepath);
+        auto fragShader = lotDevice.getShaderLibrary().load(fragFilepath);
+        std::vector<uint8_t> keyData = buildPipelineKey(
+            configInfo, vertShader->getContentHash(), fragShader->getContentHash());
+        uint64_t key = hashKeyBytes(keyData);
+
+        std::lock_guard<std::mutex> lock{mutex};
+        // 해시가 같아도 키 전체가 같아야 같은 변형 (충돌하면 같은 버킷에 따로 보관)
+        auto &bucket = variants[key];
+        for (auto &variant : bucket) {
+            if (variant->keyData == keyData) {
+                created = false;
+                return *variant;
+            }
+        }
+
+        created = true;
+        auto variant = std::make_unique<Variant>();
+        variant->key = key;
+        variant->keyData = std::move(keyData);
+        LotPipeline::copyPipelineConfigInfo(configInfo, variant->configInfo);
+        variant->vertShader = std::move(vertShader);
+        variant->fragShader = std::move(fragShader);
+        bucket.push_back(std::move(variant));
+        return *bucket.back();
+    }
+
+    const LotPipelineManager::Variant &LotPipelineManager::createBlocking(
+        const std::string &vertFilepath, const std::string &fragFilepath, const PipelineConfigInfo &configInfo) {
+        bool created = false;
+        Variant &variant = findOrAddVariant(vertFilepath, fragFilepath, configInfo, created);
+        if (created) {
+            compile(variant);
+            compiledCondition.notify_all();
+        } else {
+            // 이미 백그라운드에서 컴파일 중이면 끝날 때까지 대기
+            std::unique_lock<std::mutex> lock{mutex};
+            compiledCondition.wait(lock, [&] { return variant.isReady() || variant.hasFailed(); });
+        }
+
+        if (variant.hasFailed()) {
+            throw std::runtime_error("failed to create pipeline variant!");
+        }
+        return variant;
+    }
+
+    const LotPipelineManager::Variant &LotPipelineManager::request(
+        const std::string &vertFilepath, const std::string &fragFilepath, const PipelineConfigInfo &configInfo) {
+        bool created = false;
+        Variant &variant = findOrAddVariant(vertFilepath, fragFilepath, configInfo, created);
+        if (created) {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                compileQueue.push_back(&variant);
+            }
+            queueCondition.notify_one();
+        }
+        return variant;
+    }
+
+    void LotPipelineManager::setFallback(const Variant &variant) {
+        assert(variant.isReady() && "fallback pipeline must be created with createBlocking");
+        fallback = &variant;
+    }
+
+    LotPipeline &LotPipelineManager::resolve(const Variant &variant) const {
+        if (LotPipeline *pipeline = variant.pipeline.load(std::memory_order_acquire)) {
+            return *pipeline;
+        }
+        assert(fallback != nullptr && "no fallback pipeline set");
+        return *fallback->pipeline.load(std::memory_order_acquire);
+    }
+
+    void LotPipelineManager::evictRenderPass(VkRenderPass renderPass) {
+        std::unique_lock<std::mutex> lock{mutex};
+        auto usesRenderPass = [&](const Variant *variant) { return variant->configInfo.renderPass == renderPass; };
+
+        // 아직 시작하지 않은 컴파일은 버림
+        auto queued = std::stable_partition(compileQueue.begin(), compileQueue.end(),
+                                            [&](const Variant *variant) { return !usesRenderPass(variant); });
+        for (auto it = queued; it != compileQueue.end(); ++it) {
+            (*it)->vertShader.reset();
+            (*it)->fragShader.reset();
+        }
+        compileQueue.erase(queued, compileQueue.end());
+
+        // 컴파일 중인 변형은 컴파일이 끝나 셰이더 참조를 놓을 때까지 대기
+        compiledCondition.wait(lock, [&] {
+            for (const auto &entry : variants) {
+                for (const auto &variant : entry.second) {
+                    if (usesRenderPass(variant.get()) && variant->vertShader) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        });
+
+        if (fallback != nullptr && usesRenderPass(fallback)) {
+            fallback = nullptr;
+        }
+        // 파이프라인은 LotPipeline 소멸자에서 삭제 큐로 넘어가므로 진행 중인 프레임이 써도 안전
+        uint32_t evictedCount = 0;
+        for (auto it = variants.begin(); it != variants.end();) {
+            auto &bucket = it->second;
+            auto removed = std::remove_if(bucket.begin(), bucket.end(),
+                                          [&](const auto &variant) { return usesRenderPass(variant.get()); });
+            evictedCount += static_cast<uint32_t>(std::distance(removed, bucket.end()));
+            bucket.erase(removed, bucket.end());
+            it = bucket.empty() ? variants.erase(it) : std::next(it);
+        }
+        LOT_LOG_DEBUG("[PipelineManager] Evicted {} variants of a replaced render pass", evictedCount);
+    }
+
+    void LotPipelineManager::waitIdle() {
+        std::unique_lock<std::mutex> lock{mutex};
+        compiledCondition.wait(lock, [&] { return compileQueue.empty() && compilingCount == 0; });
+    }
+
+    uint32_t LotPipelineManager::getPendingCount() {
+        std::lock_guard<std::mutex> lock{mutex};
+        return static_cast<uint32_t>(compileQueue.size()) + compilingCount;
+    }
+
+    void LotPipelineManager::compile(Variant &variant) {
+        auto start = std::chrono::steady_clock::now();
+        try {
+            // 파이프라인 캐시는 생성 호출에 대해 내부 동기화되므로 여러 컴파일 스레드가 공유해도 됨
+            variant.ownedPipeline = std::make_unique<LotPipeline>(
+                lotDevice, *variant.vertShader, *variant.fragShader, variant.configInfo);
+            variant.pipeline.store(variant.ownedPipeline.get(), std::memory_order_release);
+        } catch (const std::exception &e) {
+            LOT_LOG_ERROR("[PipelineManager] Failed to compile variant: {}", std::string{e.what()});
+            variant.failed.store(true, std::memory_order_release);
+        }
+
+        double milliseconds = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        char key[17];
+        std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(variant.key));
+        LOT_LOG_DEBUG("[PipelineManager] Variant {} compiled in {} ms", std::string{key}, milliseconds);
+
+        // 대기자는 뮤텍스를 잡고 상태를 확인하므로 결과 저장 후 잠금을 거쳐야 알림을 놓치지 않음
+        // 셰이더 해제가 컴파일 스레드의 마지막 접근이므로 evictRenderPass는 이것을 보고 변형을 지움
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            variant.vertShader.reset();
+            variant.fragShader.reset();
+        }
+    }
+
+    void LotPipelineManager::compileLoop() {
+        while (true) {
+            Variant *variant = nullptr;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                queueCondition.wait(lock, [&] { return !running || !compileQueue.empty(); });
+                if (!running) {
+                    return;
+                }
+                variant = compileQueue.front();
+                compileQueue.pop_front();
+                compilingCount++;
+            }
+
+            compile(*variant);
+
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                compilingCount--;
+            }
+            compiledCondition.notify_all();
+        }
+    }
+} // namespace lot
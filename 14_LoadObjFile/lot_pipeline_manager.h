@@ -0,0 +1,100 @@
+#pragma once
+
+#include "lot_device.h"
+#include "lot_pipeline.h"
+#include "lot_shader_library.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace lot {
+    // 파이프라인 변형(permutation) 관리자
+    // - PipelineConfigInfo 전체와 셰이더 내용 해시로 키를 만들어 같은 요청은 하나의 변형으로 합침
+    // - 없는 변형은 전용 컴파일 스레드에서 생성하고, 준비될 때까지 resolve()는 폴백 파이프라인을 돌려줌
+    // 드라이버 컴파일은 수~수백 ms가 걸리므로 잡 시스템 워커 대신 별도 스레드를 사용 (프레임 작업을 막지 않음)
+    class LotPipelineManager {
+        public:
+            class Variant {
+                public:
+                    uint64_t getKey() const { return key; }
+                    VkRenderPass getRenderPass() const { return configInfo.renderPass; }
+                    bool isReady() const { return pipeline.load(std::memory_order_acquire) != nullptr; }
+                    bool hasFailed() const { return failed.load(std::memory_order_acquire); }
+
+                private:
+                    friend class LotPipelineManager;
+
+                    // key는 keyData의 해시. 같은 해시라도 keyData가 다르면 다른 변형
+                    uint64_t key = 0;
+                    std::vector<uint8_t> keyData;
+                    PipelineConfigInfo configInfo{};
+                    // 생성이 끝나면 해제하여 셰이더 모듈이 바로 파괴될 수 있게 함
+                    std::shared_ptr<LotShaderModule> vertShader;
+                    std::shared_ptr<LotShaderModule> fragShader;
+
+                    std::unique_ptr<LotPipeline> ownedPipeline;
+                    std::atomic<LotPipeline *> pipeline{nullptr};
+                    std::atomic<bool> failed{false};
+            };
+
+            explicit LotPipelineManager(LotDevice &device, uint32_t compileThreadCount = 2);
+            ~LotPipelineManager();
+
+            LotPipelineManager(const LotPipelineManager &) = delete;
+            LotPipelineManager &operator=(const LotPipelineManager &) = delete;
+
+            // 호출 스레드에서 바로 생성 (폴백 등 첫 프레임에 반드시 필요한 파이프라인)
+            const Variant &createBlocking(const std::string &vertFilepath, const std::string &fragFilepath,
+                                          const PipelineConfigInfo &configInfo);
+            // 백그라운드 생성 요청. 같은 설정이면 이미 있는 변형을 돌려주며 다시 컴파일하지 않음
+            // 요청마다 셰이더를 매핑해 해시하므로 돌려받은 변형은 호출자가 보관해 둘 것
+            const Variant &request(const std::string &vertFilepath, const std::string &fragFilepath,
+                                   const PipelineConfigInfo &configInfo);
+
+            void setFallback(const Variant &variant);
+            // 준비된 파이프라인, 아직이면(또는 실패했으면) 폴백. 어느 스레드에서나 호출 가능
+            LotPipeline &resolve(const Variant &variant) const;
+
+            // 렌더 패스가 새로 만들어지면 이전 렌더 패스로 만든 변형을 모두 버림
+            // 파괴된 핸들 값이 새 렌더 패스에 재사용되어 옛 변형과 키가 겹치는 것을 막음
+            // 이 렌더 패스의 변형을 참조하는 호출자(폴백 포함)는 호출 전에 참조를 놓아야 함
+            void evictRenderPass(VkRenderPass renderPass);
+
+            // 대기 중인 컴파일이 모두 끝날 때까지 대기 (로딩 화면, 벤치마크용)
+            void waitIdle();
+            uint32_t getPendingCount();
+
+            static uint64_t hashPipelineConfig(const PipelineConfigInfo &configInfo,
+                                               uint64_t vertShaderHash, uint64_t fragShaderHash);
+
+        private:
+            // 해시와 충돌 비교에 쓰는 키 전체 (셰이더 내용 해시, 설정 필드, 핸들)
+            static std::vector<uint8_t> buildPipelineKey(const PipelineConfigInfo &configInfo,
+                                                         uint64_t vertShaderHash, uint64_t fragShaderHash);
+            Variant &findOrAddVariant(const std::string &vertFilepath, const std::string &fragFilepath,
+                                      const PipelineConfigInfo &configInfo, bool &created);
+            void compile(Variant &variant);
+            void compileLoop();
+
+            LotDevice &lotDevice;
+            const Variant *fallback = nullptr;
+
+            std::mutex mutex;
+            std::condition_variable queueCondition;
+            std::condition_variable compiledCondition;
+            std::unordered_map<uint64_t, std::vector<std::unique_ptr<Variant>>> variants;
+            std::deque<Variant *> compileQueue;
+            uint32_t compilingCount = 0;
+            bool running = true;
+
+            std::vector<std::thread> compileThreads;
+    };
+} // namespace lot
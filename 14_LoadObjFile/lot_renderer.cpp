@@ -1,4 +1,8 @@
 #include "lot_renderer.h"
+#include "lot_cpu_profiler.h"
+#include "lot_flight_recorder.h"
+#include "lot_job_system.h"
+#include "lot_log.h"
 
 // libs
 #define GLM_FORCE_RADIANS
@@ -7,72 +11,173 @@
 #include <glm/gtc/constants.hpp>
 
 // std
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <mutex>
 #include <stdexcept>
-#include <thread>      // <-- added
-#include <chrono>      // <-- added
 
 namespace lot {
-    LotRenderer::LotRenderer(LotWindow& window, LotDevice& device) 
-    : lotWindow{window}, lotDevice{device} {
-        recreateSwapChain();
+    LotRenderer::LotRenderer(LotWindow* window, LotDevice& device, VkExtent2D offscreenExtent,
+                             const LotSwapChain::Config& swapChainConfig)
+    : lotWindow{window}, lotDevice{device}, swapChainConfig{swapChainConfig},
+      framesInFlight{LotSwapChain::clampFramesInFlight(swapChainConfig.framesInFlight)} {
+        if (framesInFlight != swapChainConfig.framesInFlight) {
+            LOT_LOG_WARN("Frames in flight {} is out of range (1 ~ {}), using {}",
+                         swapChainConfig.framesInFlight, LotSwapChain::MAX_FRAMES_IN_FLIGHT, framesInFlight);
+            this->swapChainConfig.framesInFlight = framesInFlight;
+        }
+        if (lotWindow == nullptr) {
+            offscreenTarget = std::make_unique<LotOffscreenTarget>(lotDevice, offscreenExtent, framesInFlight);
+        } else {
+            // 최초 생성은 메인 스레드에서 수행되므로 최소화 상태라면 이벤트를 폴링하며 대기
+            auto extent = lotWindow->getExtent();
+            while (extent.width == 0 || extent.height == 0) {
+                glfwWaitEvents();
+                extent = lotWindow->getExtent();
+            }
+            recreateSwapChain();
+        }
+        createCommandPool();
         createCommandBuffers();
+        threadCommandPools = std::make_unique<LotThreadCommandPools>(
+            lotDevice, LotJobSystem::instance().getThreadSlotCount(), VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
     }
 
-    LotRenderer::~LotRenderer() { freeCommandBuffers(); }
+    LotRenderer::~LotRenderer() {
+        // 회수한 메모리는 어떤 이미지에도 바인딩되어 있지 않으므로 바로 해제
+        freeSpareDepthAllocations(0);
+        threadCommandPools.reset();
+        freeCommandBuffers();
+        vkDestroyCommandPool(lotDevice.device(), commandPool, nullptr);
+    }
+
+    void LotRenderer::createCommandPool() {
+        commandPool = lotDevice.createGraphicsCommandPool(VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    }
 
     void LotRenderer::createCommandBuffers() {
-        commandBuffers.resize(LotSwapChain::MAX_FRAMES_IN_FLIGHT);
+        commandBuffers.resize(framesInFlight);
 
         VkCommandBufferAllocateInfo allocInfo{};
         allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        allocInfo.commandPool = lotDevice.getCommandPool();
+        allocInfo.commandPool = commandPool;
         allocInfo.commandBufferCount = static_cast<uint32_t>(commandBuffers.size());
 
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::AllocateCommandBuffers);
         if (vkAllocateCommandBuffers(lotDevice.device(), &allocInfo, commandBuffers.data()) != VK_SUCCESS) {
             throw std::runtime_error("failed to allocate command buffers!");
         }
     }
 
     void LotRenderer::freeCommandBuffers() {
-        vkFreeCommandBuffers(lotDevice.device(), lotDevice.getCommandPool(), 
+        vkFreeCommandBuffers(lotDevice.device(), commandPool, 
                              static_cast<uint32_t>(commandBuffers.size()), commandBuffers.data());
         commandBuffers.clear();
     }
 
     void LotRenderer::recreateSwapChain() {
-        auto extent = lotWindow.getExtent();
-        while (extent.width == 0 || extent.height == 0) {
-            glfwPollEvents();
-            std::this_thread::sleep_for(std::chrono::milliseconds(8));
-            extent = lotWindow.getExtent();
+        LOT_PROFILE_SCOPE("LotRenderer::recreateSwapChain");
+        auto extent = lotWindow->getExtent();
+        if (extent.width == 0 || extent.height == 0) {
+            // 최소화 상태: 렌더 스레드는 GLFW 이벤트를 폴링할 수 없으므로 다음 프레임에 다시 시도
+            swapChainRecreatePending = true;
+            return;
         }
-        vkQueueWaitIdle(lotDevice.graphicsQueue());
+        swapChainRecreatePending = false;
 
+        // 큐를 비우지 않고 교체: 이전 스왑체인은 oldSwapchain으로 넘긴 뒤 제출한 프레임이 끝날 때까지 보관
         if (lotSwapChain == nullptr) {
-            lotSwapChain = std::make_unique<LotSwapChain>(lotDevice, extent);
+            lotSwapChain = std::make_unique<LotSwapChain>(lotDevice, extent, swapChainConfig);
         } else {
             std::shared_ptr<LotSwapChain> oldSwapChain = std::move(lotSwapChain);
-            lotSwapChain = std::make_unique<LotSwapChain>(lotDevice, extent, oldSwapChain);
-            
-            if(!oldSwapChain->compareSwapFormats(*lotSwapChain.get())) {
-                throw std::runtime_error("Swap chain image(or depth) format has changed!");
+            lotSwapChain = std::make_unique<LotSwapChain>(lotDevice, extent, swapChainConfig, oldSwapChain,
+                                                          spareDepthAllocations);
+
+            // 포맷이 바뀌었으면 새 렌더 패스가 만들어졌으므로 이전 렌더 패스로 만든 파이프라인은 호환되지 않음
+            if (!oldSwapChain->compareSwapFormats(*lotSwapChain)) {
+                LOT_LOG_WARN("Swap chain image(or depth) format has changed, recreating render pass");
+                renderPassVersion++;
             }
+            retiredSwapChains.push_back({std::move(oldSwapChain), submittedFrames});
+        }
+    }
+
+    void LotRenderer::waitForRetiredSwapChains() {
+        if (retiredSwapChains.empty()) {
+            return;
+        }
+        // 새 스왑체인은 이전 스왑체인의 슬롯 번호를 이어받으므로 같은 슬롯 펜스가 이 커맨드 버퍼의 이전 제출
+        for (auto& retired : retiredSwapChains) {
+            retired.swapChain->waitForFrameFence(static_cast<uint32_t>(currentFrameIndex));
+        }
+        // 펜스가 모두 신호된 스왑체인의 깊이 이미지는 더 이상 쓰이지 않으므로 메모리를 먼저 회수
+        for (auto& retired : retiredSwapChains) {
+            if (retired.swapChain->isIdle()) {
+                for (const auto& allocation : retired.swapChain->releaseDepthAllocations()) {
+                    spareDepthAllocations.push_back(allocation);
+                }
+            }
+        }
+        // 연속 리사이즈 중에도 한 스왑체인 분량만 남기고 해제
+        freeSpareDepthAllocations(lotSwapChain->imageCount());
+
+        // 펜스는 프레젠트 완료를 보장하지 않으므로 모든 슬롯이 한 바퀴 더 돈 뒤에 해제
+        retiredSwapChains.erase(
+            std::remove_if(retiredSwapChains.begin(), retiredSwapChains.end(),
+                [this](RetiredSwapChain& retired) {
+                    return submittedFrames >= retired.retiredFrame + framesInFlight && retired.swapChain->isIdle();
+                }),
+            retiredSwapChains.end());
+    }
+
+    bool LotRenderer::collectIdleDeletions() {
+        assert(!isFrameStarted && "Can't collect idle deletions while frame is in progress");
+        // 유휴 대기는 창 모드에서만 하므로 스왑체인 펜스만 확인 (교체된 스왑체인의 프레임도 끝나야 함)
+        if (offscreenTarget || lotSwapChain == nullptr || !lotSwapChain->isIdle()) {
+            return false;
+        }
+        for (auto& retired : retiredSwapChains) {
+            if (!retired.swapChain->isIdle()) {
+                return false;
+            }
+        }
+        lotDevice.deletionQueue().collect(submittedFrames);
+        return true;
+    }
+
+    void LotRenderer::freeSpareDepthAllocations(size_t keepCount) {
+        // 큰 메모리를 남겨야 다음에 커지는 리사이즈도 흡수하므로 작은 것부터 해제
+        std::sort(spareDepthAllocations.begin(), spareDepthAllocations.end(),
+                  [](const LotSwapChain::DepthAllocation& a, const LotSwapChain::DepthAllocation& b) {
+                      return a.size > b.size;
+                  });
+        while (spareDepthAllocations.size() > keepCount) {
+            lotDevice.freeMemory(spareDepthAllocations.back().memory);
+            spareDepthAllocations.pop_back();
         }
     }
 
     VkCommandBuffer LotRenderer::beginFrame() {
+        LOT_PROFILE_SCOPE("LotRenderer::beginFrame");
         assert(!isFrameStarted && "Can't call beginFrame while already in progress");
 
-        auto result = lotSwapChain->acquireNextImage(&currentImageIndex);
+        if (swapChainRecreatePending) {
+            recreateSwapChain();
+            if (swapChainRecreatePending) {
+                return nullptr;
+            }
+        }
+
+        auto result = offscreenTarget ? offscreenTarget->acquireNextImage(&currentImageIndex)
+                                      : lotSwapChain->acquireNextImage(&currentImageIndex);
         if (result == VK_ERROR_OUT_OF_DATE_KHR) {
             recreateSwapChain();
             return nullptr;
         }
 
-        if (result == VK_TIMEOUT) {
+        if (result == VK_TIMEOUT || result == VK_NOT_READY) {
             return nullptr;                    // 이미지 아직 없음 → 이번 프레임 스킵
         }
 
@@ -81,6 +186,15 @@ namespace lot {
         }
 
         isFrameStarted = true;
+        waitForRetiredSwapChains();
+        // 이 슬롯의 펜스가 신호됐으므로 framesInFlight 전에 제출한 프레임까지 GPU가 끝냄
+        if (submittedFrames + 1 >= framesInFlight) {
+            lotDevice.deletionQueue().collect(submittedFrames + 1 - framesInFlight);
+        }
+        lotDevice.deletionQueue().beginFrame();
+
+        // 이 프레임 슬롯의 펜스를 기다렸으므로 이전에 기록한 보조 커맨드 버퍼를 재사용 가능
+        threadCommandPools->resetFrame(currentFrameIndex);
 
         auto commandBuffer = getCurrentCommandBuffer();
         VkCommandBufferBeginInfo beginInfo{};
@@ -93,26 +207,37 @@ namespace lot {
         return commandBuffer;
     }
 
-    void LotRenderer::endFrame() {
+    void LotRenderer::endFrame(LotSubmitCallback beforeSubmit) {
+        LOT_PROFILE_SCOPE("LotRenderer::endFrame");
         assert(isFrameStarted && "Can't call beginFrame while already in progress");
         auto commandBuffer = getCurrentCommandBuffer();
         if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
             throw std::runtime_error("failed to begin recoding command  buffer!");
         }  
 
-        auto result = lotSwapChain->submitCommandBuffers(&commandBuffer, &currentImageIndex);
-        if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || lotWindow.wasWindowReSized()) {
-            lotWindow.resetWindowResizedFlag();
-            recreateSwapChain();
-        } else if (result != VK_SUCCESS) {
-            throw std::runtime_error("failed to present swap chain image!");
+        if (offscreenTarget) {
+            if (beforeSubmit) {
+                beforeSubmit();
+            }
+            if (offscreenTarget->submitCommandBuffers(&commandBuffer, &currentImageIndex) != VK_SUCCESS) {
+                throw std::runtime_error("failed to submit offscreen command buffer!");
+            }
+        } else {
+            auto result = lotSwapChain->submitCommandBuffers(&commandBuffer, &currentImageIndex, beforeSubmit);
+            if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || lotWindow->wasWindowReSized()) {
+                lotWindow->resetWindowResizedFlag();
+                recreateSwapChain();
+            } else if (result != VK_SUCCESS) {
+                throw std::runtime_error("failed to present swap chain image!");
+            }
         }
 
         isFrameStarted = false;
-        currentFrameIndex = (currentFrameIndex + 1) % LotSwapChain::MAX_FRAMES_IN_FLIGHT;
+        submittedFrames++;
+        currentFrameIndex = (currentFrameIndex + 1) % static_cast<int>(framesInFlight);
     }
 
-    void LotRenderer::beginSwapChainRenderPass(VkCommandBuffer commandBuffer) {
+    void LotRenderer::beginSwapChainRenderPass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
         assert(isFrameStarted && "Can't call beginSwapChainRenderPass if frame is not in progress");
         assert(
             commandBuffer == getCurrentCommandBuffer() &&
@@ -120,11 +245,12 @@ namespace lot {
 
         VkRenderPassBeginInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = lotSwapChain->getRenderPass();
-        renderPassInfo.framebuffer = lotSwapChain->getFrameBuffer(currentImageIndex);
+        VkExtent2D extent = getSwapChainExtent();
+        renderPassInfo.renderPass = getSwapChainRenderPass();
+        renderPassInfo.framebuffer = getCurrentFramebuffer();
 
         renderPassInfo.renderArea.offset = {0, 0};
-        renderPassInfo.renderArea.extent = lotSwapChain->getSwapChainExtent();
+        renderPassInfo.renderArea.extent = extent;
 
         std::array<VkClearValue, 2> clearValues{};
         clearValues[0].color = { 0.01f, 0.01f, 0.01f, 1.0f };
@@ -132,16 +258,21 @@ namespace lot {
         renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
         renderPassInfo.pClearValues = clearValues.data();
 
-        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, contents);
+
+        // 보조 커맨드 버퍼는 동적 상태를 상속하지 않으므로 각 보조 버퍼에서 직접 설정
+        if (contents != VK_SUBPASS_CONTENTS_INLINE) {
+            return;
+        }
 
         VkViewport viewport{};
         viewport.x = 0.0f;
         viewport.y = 0.0f;
-        viewport.width = static_cast<float>(lotSwapChain->getSwapChainExtent().width);
-        viewport.height = static_cast<float>(lotSwapChain->getSwapChainExtent().height);
+        viewport.width = static_cast<float>(extent.width);
+        viewport.height = static_cast<float>(extent.height);
         viewport.minDepth = 0.0f;
         viewport.maxDepth = 1.0f;
-        VkRect2D scissor{{0, 0}, lotSwapChain->getSwapChainExtent()};
+        VkRect2D scissor{{0, 0}, extent};
         vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
         vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
     }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "lot_device.h"
+#include "lot_offscreen_target.h"
 #include "lot_swap_chain.h"
+#include "lot_thread_command_pools.h"
 #include "lot_window.h"
 
 #include <cassert>
@@ -11,15 +13,31 @@
 namespace lot {
     class LotRenderer {
         public:
-            LotRenderer(LotWindow &window, LotDevice &device);
+            // window가 nullptr이면 스왑체인 대신 offscreenExtent 크기의 오프스크린 타깃에 렌더링
+            // (오프스크린 타깃은 swapChainConfig의 framesInFlight만 사용)
+            LotRenderer(LotWindow *window, LotDevice &device, VkExtent2D offscreenExtent = {},
+                        const LotSwapChain::Config &swapChainConfig = LotSwapChain::Config{});
             ~LotRenderer();
 
             LotRenderer(const LotRenderer &) = delete;
             LotRenderer &operator=(const LotRenderer&) = delete;
 
-            VkRenderPass getSwapChainRenderPass() const { return lotSwapChain->getRenderPass(); }
-            float getAspectRatio() const { return lotSwapChain->extentAspectRatio(); }
+            VkRenderPass getSwapChainRenderPass() const {
+                return offscreenTarget ? offscreenTarget->getRenderPass() : lotSwapChain->getRenderPass();
+            }
+            VkExtent2D getSwapChainExtent() const {
+                return offscreenTarget ? offscreenTarget->getExtent() : lotSwapChain->getSwapChainExtent();
+            }
+            float getAspectRatio() const {
+                return offscreenTarget ? offscreenTarget->extentAspectRatio() : lotSwapChain->extentAspectRatio();
+            }
+            bool isHeadless() const { return offscreenTarget != nullptr; }
             bool isFrameInProgress() const { return isFrameStarted; }
+            bool isSwapChainRecreatePending() const { return swapChainRecreatePending; }
+            // 스왑체인 포맷이 바뀌어 렌더 패스를 새로 만들 때마다 증가 (렌더 시스템은 파이프라인을 다시 만들어야 함)
+            uint64_t getRenderPassVersion() const { return renderPassVersion; }
+            // 프레임 인덱스는 0 ~ getFramesInFlight() - 1 (MAX_FRAMES_IN_FLIGHT 이하)
+            uint32_t getFramesInFlight() const { return framesInFlight; }
 
             VkCommandBuffer getCurrentCommandBuffer() const {
                 assert(isFrameStarted && "Cannot get command buffer when frame not in progress");
@@ -31,23 +49,61 @@ namespace lot {
                 return currentFrameIndex;
             }
 
+            VkFramebuffer getCurrentFramebuffer() const {
+                assert(isFrameStarted && "Cannot get framebuffer when frame not in progress");
+                return offscreenTarget ? offscreenTarget->getFrameBuffer(currentImageIndex)
+                                       : lotSwapChain->getFrameBuffer(currentImageIndex);
+            }
+
+            LotThreadCommandPools &getThreadCommandPools() { return *threadCommandPools; }
+
             VkCommandBuffer beginFrame();
-            void endFrame();
-            void beginSwapChainRenderPass(VkCommandBuffer commandBuffer);
+            // 프레임을 기록하지 않는 동안 호출 (온디맨드 유휴 대기 전 등, 대기하지 않음)
+            // 제출한 프레임이 모두 끝났으면 지연 파괴 큐를 비우고 true
+            bool collectIdleDeletions();
+            // beforeSubmit은 커맨드 버퍼 기록이 끝나고 큐 제출 직전에 호출됨
+            // (기록된 커맨드가 참조하는 매핑 버퍼에 최신 값을 늦게 써 넣는 용도)
+            void endFrame(LotSubmitCallback beforeSubmit = {});
+            // 보조 커맨드 버퍼로 기록할 때는 VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS 사용
+            void beginSwapChainRenderPass(VkCommandBuffer commandBuffer,
+                                          VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
             void endSwapChainRenderPass(VkCommandBuffer commandBuffer);
 
         private:
+            void createCommandPool();
             void createCommandBuffers();
             void freeCommandBuffers();
             void recreateSwapChain();
+            // 교체된 스왑체인: 이 프레임 슬롯의 이전 제출을 기다리고, 모든 프레임이 끝난 것은 깊이 메모리를 회수한 뒤 해제
+            void waitForRetiredSwapChains();
+            void freeSpareDepthAllocations(size_t keepCount);
 
-            LotWindow& lotWindow;
+            LotWindow* lotWindow;
             LotDevice& lotDevice;
+            LotSwapChain::Config swapChainConfig;
+            uint32_t framesInFlight;
+            // 둘 중 하나만 사용 (창이 있으면 스왑체인, 헤드리스면 오프스크린 타깃)
             std::unique_ptr<LotSwapChain> lotSwapChain;
+            std::unique_ptr<LotOffscreenTarget> offscreenTarget;
+            // 리사이즈로 교체됐지만 아직 GPU가 쓰고 있을 수 있는 스왑체인 (retiredFrame은 교체 시점의 제출 수)
+            struct RetiredSwapChain {
+                std::shared_ptr<LotSwapChain> swapChain;
+                uint64_t retiredFrame;
+            };
+            std::vector<RetiredSwapChain> retiredSwapChains;
+            // 프레임이 모두 끝난 교체된 스왑체인에서 회수한 깊이 메모리 (다음 리사이즈에서 재사용)
+            std::vector<LotSwapChain::DepthAllocation> spareDepthAllocations;
+            uint64_t submittedFrames{0};
+            uint64_t renderPassVersion{0};
+            // 렌더 스레드 전용 커맨드 풀 (디바이스 풀은 메인 스레드 업로드용)
+            VkCommandPool commandPool = VK_NULL_HANDLE;
             std::vector<VkCommandBuffer> commandBuffers;
+            // 병렬 기록용 스레드 슬롯별 보조 커맨드 풀
+            std::unique_ptr<LotThreadCommandPools> threadCommandPools;
 
             uint32_t currentImageIndex;
             int currentFrameIndex{0};
             bool isFrameStarted{false};
+            bool swapChainRecreatePending{false};
     };
 } // namespace lot
\ No newline at end of file
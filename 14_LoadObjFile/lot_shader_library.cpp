@@ -0,0 +1,177 @@
+#include "lot_shader_library.h"
+#include "lot_embedded_shaders.h"
+
+// std
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+// 파일 매핑
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace lot {
+    namespace {
+        // 읽기 전용 파일 매핑 (RAII)
+        // 매핑 주소는 페이지 정렬이므로 SPIR-V의 uint32_t 정렬 요구를 만족함
+        class MappedFile {
+            public:
+                explicit MappedFile(const std::string &filepath) {
+                #ifdef _WIN32
+                    file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                    if (file == INVALID_HANDLE_VALUE) {
+                        throw std::runtime_error("failed to open file : " + filepath);
+                    }
+                    LARGE_INTEGER fileSize{};
+                    GetFileSizeEx(file, &fileSize);
+                    size = static_cast<size_t>(fileSize.QuadPart);
+                    if (size == 0) return;
+
+                    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    if (mapping) {
+                        data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    }
+                #else
+                    fd = open(filepath.c_str(), O_RDONLY);
+                    if (fd < 0) {
+                        throw std::runtime_error("failed to open file : " + filepath);
+                    }
+                    struct stat fileStat{};
+                    fstat(fd, &fileStat);
+                    size = static_cast<size_t>(fileStat.st_size);
+                    if (size == 0) return;
+
+                    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    data = mapped == MAP_FAILED ? nullptr : mapped;
+                #endif
+                    if (!data) {
+                        release();
+                        throw std::runtime_error("failed to map file : " + filepath);
+                    }
+                }
+
+                ~MappedFile() { release(); }
+
+                MappedFile(const MappedFile &) = delete;
+                MappedFile &operator=(const MappedFile &) = delete;
+
+                const void *getData() const { return data; }
+                size_t getSize() const { return size; }
+
+            private:
+                void release() {
+                #ifdef _WIN32
+                    if (data) UnmapViewOfFile(data);
+                    if (mapping) CloseHandle(mapping);
+                    if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+                    mapping = nullptr;
+                    file = INVALID_HANDLE_VALUE;
+                #else
+                    if (data) munmap(data, size);
+                    if (fd >= 0) close(fd);
+                    fd = -1;
+                #endif
+                    data = nullptr;
+                }
+
+            #ifdef _WIN32
+                HANDLE file = INVALID_HANDLE_VALUE;
+                HANDLE mapping = nullptr;
+            #else
+                int fd = -1;
+            #endif
+                void *data = nullptr;
+                size_t size = 0;
+        };
+    }
+
+    LotShaderModule::LotShaderModule(VkDevice device, const uint32_t *code, size_t codeSize,
+                                     std::string filepath, uint64_t contentHash)
+    : device{device}, filepath{std::move(filepath)}, contentHash{contentHash} {
+        VkShaderModuleCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.codeSize = codeSize;
+        createInfo.pCode = code;
+
+        if (vkCreateShaderModule(device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create shader module");
+        }
+    }
+
+    LotShaderModule::~LotShaderModule() {
+        vkDestroyShaderModule(device, shaderModule, nullptr);
+    }
+
+    LotShaderLibrary::LotShaderLibrary(VkDevice device) : device{device} {
+        if (const char *env = std::getenv("LOT_SHADER_FILES")) {
+            loadFromFiles = std::strcmp(env, "0") != 0;
+        }
+    }
+
+    uint64_t LotShaderLibrary::hashContent(const void *data, size_t size) {
+        // FNV-1a 64비트
+        const auto *bytes = static_cast<const unsigned char *>(data);
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    std::shared_ptr<LotShaderModule> LotShaderLibrary::load(const std::string &filepath) {
+        if (!loadFromFiles) {
+            if (const LotEmbeddedShader *embedded = LotEmbeddedShaders::find(filepath)) {
+                return findOrCreate(filepath, embedded->code, embedded->codeSize);
+            }
+        }
+
+        // 파일이 바뀌었을 수 있으므로 항상 매핑해 해시를 다시 계산 (매핑은 복사가 없어 저렴함)
+        MappedFile file{filepath};
+        if (file.getSize() == 0 || file.getSize() % sizeof(uint32_t) != 0) {
+            throw std::runtime_error("invalid SPIR-V file : " + filepath);
+        }
+        return findOrCreate(filepath, static_cast<const uint32_t *>(file.getData()), file.getSize());
+    }
+
+    std::shared_ptr<LotShaderModule> LotShaderLibrary::findOrCreate(const std::string &filepath,
+                                                                    const uint32_t *code, size_t codeSize) {
+        uint64_t contentHash = hashContent(code, codeSize);
+
+        std::lock_guard<std::mutex> lock{mutex};
+
+        PathEntry &pathEntry = modulesByPath[filepath];
+        if (pathEntry.contentHash == contentHash) {
+            if (auto module = pathEntry.module.lock()) {
+                cacheHits++;
+                return module;
+            }
+        }
+
+        // 다른 경로에 같은 내용의 셰이더가 살아 있으면 그 모듈을 공유
+        auto &hashEntry = modulesByHash[contentHash];
+        auto module = hashEntry.lock();
+        if (module) {
+            cacheHits++;
+        } else {
+            module = std::make_shared<LotShaderModule>(device, code, codeSize, filepath, contentHash);
+            hashEntry = module;
+            modulesCreated++;
+        }
+
+        pathEntry.contentHash = contentHash;
+        pathEntry.module = module;
+        return module;
+    }
+} // namespace lot
@@ -0,0 +1,83 @@
+#pragma once
+
+#ifdef __APPLE__
+    #include "vulkan/vulkan_beta.h"
+#else
+    #include "vulkan/vulkan.h"
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace lot {
+    // 참조 카운트로 수명이 관리되는 VkShaderModule
+    // 마지막 shared_ptr이 사라지면 모듈이 파괴됨
+    class LotShaderModule {
+        public:
+            LotShaderModule(VkDevice device, const uint32_t *code, size_t codeSize,
+                            std::string filepath, uint64_t contentHash);
+            ~LotShaderModule();
+
+            LotShaderModule(const LotShaderModule &) = delete;
+            LotShaderModule &operator=(const LotShaderModule &) = delete;
+
+            VkShaderModule getShaderModule() const { return shaderModule; }
+            const std::string &getFilepath() const { return filepath; }
+            uint64_t getContentHash() const { return contentHash; }
+
+        private:
+            VkDevice device;
+            VkShaderModule shaderModule = VK_NULL_HANDLE;
+            std::string filepath;
+            uint64_t contentHash;
+    };
+
+    // SPIR-V 셰이더 모듈 레지스트리
+    // - 기본적으로 실행 파일에 포함된 SPIR-V(LotEmbeddedShaders)를 사용하여 파일 I/O가 없음
+    // - 포함되지 않았거나 파일 로드를 켠 경우 파일을 mmap으로 매핑해 복사 없이 vkCreateShaderModule에 넘김
+    // - 경로와 내용 해시(FNV-1a)로 모듈을 찾으므로 같은 셰이더는 한 번만 생성됨
+    // - 레지스트리는 약한 참조만 가지므로 파이프라인 생성이 끝나 아무도 쓰지 않으면 모듈이 바로 해제됨
+    class LotShaderLibrary {
+        public:
+            explicit LotShaderLibrary(VkDevice device);
+
+            LotShaderLibrary(const LotShaderLibrary &) = delete;
+            LotShaderLibrary &operator=(const LotShaderLibrary &) = delete;
+
+            // 여러 스레드에서 호출해도 안전
+            std::shared_ptr<LotShaderModule> load(const std::string &filepath);
+
+            // 셰이더를 고치며 반복 작업할 때 포함된 SPIR-V 대신 디스크의 .spv를 읽음
+            // (LOT_SHADER_FILES=1 환경 변수로도 켤 수 있음)
+            void setLoadFromFiles(bool enabled) { loadFromFiles = enabled; }
+            bool isLoadingFromFiles() const { return loadFromFiles; }
+
+            // 통계 (중복 제거 효과 확인용)
+            uint32_t getModulesCreated() const { return modulesCreated; }
+            uint32_t getCacheHits() const { return cacheHits; }
+
+            static uint64_t hashContent(const void *data, size_t size);
+
+        private:
+            std::shared_ptr<LotShaderModule> findOrCreate(const std::string &filepath,
+                                                          const uint32_t *code, size_t codeSize);
+
+            struct PathEntry {
+                uint64_t contentHash = 0;
+                std::weak_ptr<LotShaderModule> module;
+            };
+
+            VkDevice device;
+            std::mutex mutex;
+            std::unordered_map<std::string, PathEntry> modulesByPath;
+            std::unordered_map<uint64_t, std::weak_ptr<LotShaderModule>> modulesByHash;
+            uint32_t modulesCreated = 0;
+            uint32_t cacheHits = 0;
+            std::atomic<bool> loadFromFiles{false};
+    };
+} // namespace lot
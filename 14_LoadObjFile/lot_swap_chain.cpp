@@ -1,36 +1,60 @@
 #include "lot_swap_chain.h"
+#include "lot_cpu_profiler.h"
+#include "lot_flight_recorder.h"
+#include "lot_log.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <set>
 #include <stdexcept>
 
 namespace lot {
-    LotSwapChain::LotSwapChain(LotDevice &deviceRef, VkExtent2D extent) 
-    : device{deviceRef}, windowExtent{extent} {
+    LotSwapChain::LotSwapChain(LotDevice &deviceRef, VkExtent2D extent, const Config &config)
+    : device{deviceRef}, windowExtent{extent}, config{config}, framesInFlight{clampFramesInFlight(config.framesInFlight)} {
         init();
     }
 
-    LotSwapChain::LotSwapChain(LotDevice &deviceRef, VkExtent2D extent, std::shared_ptr<LotSwapChain> previous) 
-    : device{deviceRef}, windowExtent{extent}, oldSwapChain{previous} {
+    LotSwapChain::LotSwapChain(LotDevice &deviceRef, VkExtent2D extent, const Config &config,
+                               std::shared_ptr<LotSwapChain> previous, std::vector<DepthAllocation> &spareDepthAllocations)
+    : device{deviceRef}, windowExtent{extent}, config{config}, framesInFlight{clampFramesInFlight(config.framesInFlight)},
+      oldSwapChain{previous}, spareDepthAllocations{&spareDepthAllocations} {
         init();
         oldSwapChain = nullptr;
+        this->spareDepthAllocations = nullptr;
     }
 
     void LotSwapChain::init() {
         createSwapChain();
         createImageViews();
-        createRenderPass();
+        swapChainDepthFormat = findDepthFormat();
+        // 새로 고른 포맷이 이전과 같을 때만 렌더 패스를 넘겨받음 (첨부 포맷에만 의존하므로 파이프라인 호환성도 유지)
+        // 포맷이 바뀌면 새 렌더 패스를 만들고, 렌더러가 파이프라인을 다시 만들도록 알림
+        if (oldSwapChain != nullptr && compareSwapFormats(*oldSwapChain)) {
+            renderPass = oldSwapChain->renderPass;
+            oldSwapChain->renderPass = VK_NULL_HANDLE;
+        } else {
+            createRenderPass();
+        }
         createDepthResource();
         createFramebuffers();
         createSyncObjects();
+        if (oldSwapChain != nullptr) {
+            currentFrame = oldSwapChain->currentFrame % framesInFlight;
+        }
     }
 
     LotSwapChain::~LotSwapChain() {
-        vkDeviceWaitIdle(device.device());
+        // 다른 스왑체인의 프레임은 기다리지 않음 (교체된 스왑체인은 LotRenderer가 펜스가 끝난 뒤 해제)
+        if (!inFlightFences.empty()) {
+            LotFlightRecorder::countVulkanCall(LotVulkanCall::WaitForFences);
+            vkWaitForFences(device.device(), static_cast<uint32_t>(inFlightFences.size()), inFlightFences.data(),
+                            VK_TRUE, std::numeric_limits<uint64_t>::max());
+        }
 
         for (auto imageView : swapChainImageViews) {
             vkDestroyImageView(device.device(), imageView, nullptr);
@@ -45,17 +69,22 @@ namespace lot {
         for (int i = 0; i < depthImages.size(); i++) {
             vkDestroyImageView(device.device(), depthImageViews[i], nullptr);
             vkDestroyImage(device.device(), depthImages[i], nullptr);
-            vkFreeMemory(device.device(), depthImageMemorys[i], nullptr);
+        }
+        // 렌더러가 releaseDepthAllocations로 회수한 뒤라면 비어 있음
+        for (const auto &allocation : depthAllocations) {
+            device.freeMemory(allocation.memory);
         }
 
         for (auto framebuffer : swapChainFramebuffers) {
             vkDestroyFramebuffer(device.device(), framebuffer, nullptr);
         }
 
-        vkDestroyRenderPass(device.device(), renderPass, nullptr);
+        if (renderPass != VK_NULL_HANDLE) {
+            vkDestroyRenderPass(device.device(), renderPass, nullptr);
+        }
 
         // cleanup synchronization objects
-        for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+        for (size_t i = 0; i < framesInFlight; i++) {
             vkDestroySemaphore(device.device(), renderFinishedSemaphores[i], nullptr);
             vkDestroySemaphore(device.device(), imageAvailableSemaphores[i], nullptr);
             vkDestroyFence(device.device(), inFlightFences[i], nullptr);
@@ -69,15 +98,52 @@ namespace lot {
             VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT);
     }
 
+    void LotSwapChain::waitForFrameFence(uint32_t frameIndex) {
+        if (frameIndex >= inFlightFences.size()) {
+            return;
+        }
+        LOT_PROFILE_SCOPE("waitForRetiredFrameFence");
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::WaitForFences);
+        vkWaitForFences(device.device(), 1, &inFlightFences[frameIndex], VK_TRUE,
+                        std::numeric_limits<uint64_t>::max());
+    }
+
+    std::vector<LotSwapChain::DepthAllocation> LotSwapChain::releaseDepthAllocations() {
+        for (size_t i = 0; i < depthImages.size(); i++) {
+            vkDestroyImageView(device.device(), depthImageViews[i], nullptr);
+            vkDestroyImage(device.device(), depthImages[i], nullptr);
+        }
+        depthImageViews.clear();
+        depthImages.clear();
+        std::vector<DepthAllocation> released;
+        released.swap(depthAllocations);
+        return released;
+    }
+
+    bool LotSwapChain::isIdle() {
+        for (auto fence : inFlightFences) {
+            if (vkGetFenceStatus(device.device(), fence) != VK_SUCCESS) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     #ifdef __linux__
         static constexpr uint64_t ACQUIRE_TIMEOUT_NS = std::numeric_limits<uint64_t>::max(); // Linux: 1초
     #else
         static constexpr uint64_t ACQUIRE_TIMEOUT_NS = 0; // Windows/macOS: 즉시 반환
     #endif
     VkResult LotSwapChain::acquireNextImage(uint32_t *imageIndex) {
-        vkWaitForFences(device.device(), 1, &inFlightFences[currentFrame], VK_TRUE, 
-                        std::numeric_limits<uint64_t>::max());
+        {
+            LOT_PROFILE_SCOPE("waitForFrameFence");
+            LotFlightRecorder::countVulkanCall(LotVulkanCall::WaitForFences);
+            vkWaitForFences(device.device(), 1, &inFlightFences[currentFrame], VK_TRUE, 
+                            std::numeric_limits<uint64_t>::max());
+        }
 
+        LOT_PROFILE_SCOPE("vkAcquireNextImageKHR");
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::AcquireNextImage);
         VkResult result = vkAcquireNextImageKHR(device.device(), swapChain, 
                                                 //std::numeric_limits<uint64_t>::max(), 
                                                 ACQUIRE_TIMEOUT_NS,
@@ -87,12 +153,22 @@ namespace lot {
         return result;
     }
 
-    VkResult LotSwapChain::submitCommandBuffers(const VkCommandBuffer *buffers, uint32_t *imageIndex) {
+    VkResult LotSwapChain::submitCommandBuffers(const VkCommandBuffer *buffers, uint32_t *imageIndex,
+                                                LotSubmitCallback beforeSubmit) {
+        LOT_PROFILE_SCOPE("LotSwapChain::submitCommandBuffers");
         if (imagesInFlight[*imageIndex] != VK_NULL_HANDLE) {
+            LOT_PROFILE_SCOPE("waitForImageFence");
+            LotFlightRecorder::countVulkanCall(LotVulkanCall::WaitForFences);
             vkWaitForFences(device.device(), 1, &imagesInFlight[*imageIndex], VK_TRUE, UINT64_MAX);
         }
         imagesInFlight[*imageIndex] = inFlightFences[currentFrame];
 
+        // 대기가 모두 끝난 뒤라 여기서 쓴 값이 GPU가 읽기 전 마지막 CPU 쓰기가 됨
+        if (beforeSubmit) {
+            LOT_PROFILE_SCOPE("beforeSubmit");
+            beforeSubmit();
+        }
+
         VkSubmitInfo submitInfo = {};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
@@ -109,7 +185,11 @@ namespace lot {
         submitInfo.signalSemaphoreCount = 1;
         submitInfo.pSignalSemaphores = signalSemaphores;
 
+        // 메인 스레드의 업로드(endSingleTimeCommands)와 같은 큐를 공유하므로 제출~프레젠트 구간 잠금
+        std::lock_guard<std::mutex> lock{device.queueMutex()};
+
         vkResetFences(device.device(), 1, &inFlightFences[currentFrame]);
+        LotFlightRecorder::countVulkanCall(LotVulkanCall::QueueSubmit);
         if (vkQueueSubmit(device.graphicsQueue(), 1, &submitInfo, inFlightFences[currentFrame]) != VK_SUCCESS) {
             throw std::runtime_error("failed to submit draw command buffer!");
         }
@@ -126,9 +206,14 @@ namespace lot {
 
         presentInfo.pImageIndices = imageIndex;
 
-        auto result = vkQueuePresentKHR(device.graphicsQueue(), &presentInfo);
+        VkResult result;
+        {
+            LOT_PROFILE_SCOPE("vkQueuePresentKHR");
+            LotFlightRecorder::countVulkanCall(LotVulkanCall::QueuePresent);
+            result = vkQueuePresentKHR(device.graphicsQueue(), &presentInfo);
+        }
 
-        currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+        currentFrame = (currentFrame + 1) % framesInFlight;
 
         return result;
     }
@@ -137,10 +222,12 @@ namespace lot {
         SwapChainSupportDetails swapChainSupport = device.getSwapChainSupport();
 
         VkSurfaceFormatKHR surfaceFormat = chooseSwapSurfaceFormat(swapChainSupport.formats);
-        VkPresentModeKHR presentMode = chooseSwapPresentmode(swapChainSupport.presentModes);
+        presentMode = chooseSwapPresentmode(swapChainSupport.presentModes);
         VkExtent2D extent = chooseSwapExtent(swapChainSupport.capabilities);
 
-        uint32_t imageCount = swapChainSupport.capabilities.minImageCount + 1;
+        uint32_t imageCount = config.imageCount > 0
+            ? std::max(config.imageCount, swapChainSupport.capabilities.minImageCount)
+            : swapChainSupport.capabilities.minImageCount + 1;
         if (swapChainSupport.capabilities.maxImageCount > 0 &&
             imageCount > swapChainSupport.capabilities.maxImageCount) {
             imageCount = swapChainSupport.capabilities.maxImageCount;
@@ -211,13 +298,13 @@ namespace lot {
     }
 
     void LotSwapChain::createDepthResource() {
-        VkFormat depthFormat = findDepthFormat();
-        swapChainDepthFormat = depthFormat;
+        VkFormat depthFormat = swapChainDepthFormat;
         VkExtent2D swapChainExtent = getSwapChainExtent();
 
         depthImages.resize(imageCount());
-        depthImageMemorys.resize(imageCount());
+        depthAllocations.resize(imageCount());
         depthImageViews.resize(imageCount());
+        size_t reusedCount = 0;
 
         for (int i = 0; i < depthImages.size(); i++) {
             VkImageCreateInfo imageInfo{};
@@ -236,8 +323,34 @@ namespace lot {
             imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
             imageInfo.flags = 0;
 
-            device.createImageWithInfo(
-                imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, depthImages[i], depthImageMemorys[i]);
+            if (vkCreateImage(device.device(), &imageInfo, nullptr, &depthImages[i]) != VK_SUCCESS) {
+                throw std::runtime_error("failed to create depth image!");
+            }
+
+            // 회수해 둔 메모리 중 크기와 타입이 맞는 것을 사용
+            // (렌더러는 프레임이 모두 끝난 스왑체인에서만 회수하므로 GPU가 아직 쓰는 메모리는 없음)
+            VkMemoryRequirements requirements;
+            vkGetImageMemoryRequirements(device.device(), depthImages[i], &requirements);
+            depthAllocations[i] = DepthAllocation{};
+            if (spareDepthAllocations != nullptr) {
+                auto &spares = *spareDepthAllocations;
+                auto fit = std::find_if(spares.begin(), spares.end(), [&requirements](const DepthAllocation &spare) {
+                    return spare.size >= requirements.size &&
+                           (requirements.memoryTypeBits & (1u << spare.memoryTypeIndex)) != 0;
+                });
+                if (fit != spares.end()) {
+                    depthAllocations[i] = *fit;
+                    *fit = spares.back();
+                    spares.pop_back();
+                    reusedCount++;
+                }
+            }
+            if (depthAllocations[i].memory == VK_NULL_HANDLE) {
+                depthAllocations[i] = allocateDepthMemory(requirements);
+            }
+            if (vkBindImageMemory(device.device(), depthImages[i], depthAllocations[i].memory, 0) != VK_SUCCESS) {
+                throw std::runtime_error("failed to bind depth image memory!");
+            }
             
             VkImageViewCreateInfo viewInfo{};
             viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -254,11 +367,33 @@ namespace lot {
                 throw std::runtime_error("failed to create texture image view");
             }
         }
+        if (oldSwapChain != nullptr) {
+            LOT_LOG_DEBUG("Swap chain resized to {}x{}, reused {}/{} depth allocation(s)",
+                          swapChainExtent.width, swapChainExtent.height, reusedCount, depthImages.size());
+        }
+    }
+
+    LotSwapChain::DepthAllocation LotSwapChain::allocateDepthMemory(const VkMemoryRequirements &requirements) {
+        // 필요한 크기를 버킷 단위로 올린 면적 비율만큼 늘려 할당 (조금 커지는 리사이즈는 다음 번에 재사용)
+        auto roundUp = [](uint32_t value) {
+            return (value + DEPTH_SIZE_BUCKET - 1) / DEPTH_SIZE_BUCKET * DEPTH_SIZE_BUCKET;
+        };
+        double pixels = static_cast<double>(swapChainExtent.width) * swapChainExtent.height;
+        double bucketPixels = static_cast<double>(roundUp(swapChainExtent.width)) * roundUp(swapChainExtent.height);
+        VkDeviceSize alignment = std::max<VkDeviceSize>(requirements.alignment, 1);
+        VkDeviceSize size = static_cast<VkDeviceSize>(static_cast<double>(requirements.size) * bucketPixels / pixels);
+        size = std::max(requirements.size, (size + alignment - 1) / alignment * alignment);
+
+        DepthAllocation allocation;
+        allocation.memoryTypeIndex = device.findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        allocation.memory = device.allocateMemory(size, allocation.memoryTypeIndex);
+        allocation.size = size;
+        return allocation;
     }
 
     void LotSwapChain::createRenderPass() {
         VkAttachmentDescription depthAttachment{};
-        depthAttachment.format = findDepthFormat();
+        depthAttachment.format = swapChainDepthFormat;
         depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
         depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
         depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
@@ -339,9 +474,9 @@ namespace lot {
     }
 
     void LotSwapChain::createSyncObjects() {
-        imageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-        renderFinishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-        inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
+        imageAvailableSemaphores.resize(framesInFlight);
+        renderFinishedSemaphores.resize(framesInFlight);
+        inFlightFences.resize(framesInFlight);
         imagesInFlight.resize(imageCount(), VK_NULL_HANDLE);
 
         VkSemaphoreCreateInfo semaphoreInfo = {};
@@ -351,7 +486,7 @@ namespace lot {
         fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
         fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
-        for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+        for (size_t i = 0; i < framesInFlight; i++) {
             if (vkCreateSemaphore(device.device(), &semaphoreInfo, nullptr, &imageAvailableSemaphores[i]) != VK_SUCCESS ||
                 vkCreateSemaphore(device.device(), &semaphoreInfo, nullptr, &renderFinishedSemaphores[i]) != VK_SUCCESS ||
                 vkCreateFence(device.device(), &fenceInfo, nullptr, &inFlightFences[i]) != VK_SUCCESS) {
@@ -370,16 +505,46 @@ namespace lot {
         return availableFormats[0];
     }
 
+    const char *LotSwapChain::presentModeName(Config::PresentMode mode) {
+        switch (mode) {
+            case Config::PresentMode::Immediate: return "immediate";
+            case Config::PresentMode::Mailbox: return "mailbox";
+            case Config::PresentMode::Fifo: return "fifo";
+            case Config::PresentMode::FifoRelaxed: return "fifo-relaxed";
+            default: return "auto";
+        }
+    }
+
+    uint32_t LotSwapChain::clampFramesInFlight(uint32_t framesInFlight) {
+        return std::clamp(framesInFlight, 1u, static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT));
+    }
+
     VkPresentModeKHR LotSwapChain::chooseSwapPresentmode(const std::vector<VkPresentModeKHR> &availablePresentModes) {
-        for (const auto &availablePresentMode : availablePresentModes) {
-            if (availablePresentMode == VK_PRESENT_MODE_MAILBOX_KHR) {
-                std::cout << "Present mode : MailBox" << std::endl;
-                return availablePresentMode;
-            }
+        auto isAvailable = [&availablePresentModes](VkPresentModeKHR mode) {
+            return std::find(availablePresentModes.begin(), availablePresentModes.end(), mode) != availablePresentModes.end();
+        };
+
+        VkPresentModeKHR requested = VK_PRESENT_MODE_FIFO_KHR;
+        switch (config.presentMode) {
+            case Config::PresentMode::Auto:
+                if (isAvailable(VK_PRESENT_MODE_MAILBOX_KHR)) {
+                    LOT_LOG_INFO("Present mode : MailBox");
+                    return VK_PRESENT_MODE_MAILBOX_KHR;
+                }
+                LOT_LOG_INFO("Present mode : V-Sync");
+                return VK_PRESENT_MODE_FIFO_KHR;
+            case Config::PresentMode::Immediate: requested = VK_PRESENT_MODE_IMMEDIATE_KHR; break;
+            case Config::PresentMode::Mailbox: requested = VK_PRESENT_MODE_MAILBOX_KHR; break;
+            case Config::PresentMode::Fifo: requested = VK_PRESENT_MODE_FIFO_KHR; break;
+            case Config::PresentMode::FifoRelaxed: requested = VK_PRESENT_MODE_FIFO_RELAXED_KHR; break;
         }
 
-        std::cout << "Present mode : V-Sync" << std::endl;
-        return VK_PRESENT_MODE_FIFO_KHR;
+        if (!isAvailable(requested)) {
+            LOT_LOG_WARN("Present mode {} is not supported, falling back to fifo", presentModeName(config.presentMode));
+            return VK_PRESENT_MODE_FIFO_KHR;
+        }
+        LOT_LOG_INFO("Present mode : {}, {} frame(s) in flight", presentModeName(config.presentMode), framesInFlight);
+        return requested;
     }
 
     VkExtent2D LotSwapChain::chooseSwapExtent(const VkSurfaceCapabilitiesKHR &capabilities) {
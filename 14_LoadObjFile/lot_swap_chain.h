@@ -7,15 +7,67 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace lot {
-    class LotSwapChain {
+    // 제출 직전에 호출할 함수의 비소유 참조 (std::function과 달리 캡처가 커도 힙 할당이 없음)
+    // 넘긴 람다는 호출이 끝날 때까지 살아 있어야 하므로 인자로 바로 넘기는 용도로만 사용
+    class LotSubmitCallback {
         public:
-            static constexpr int MAX_FRAMES_IN_FLIGHT = 2;
+            LotSubmitCallback() = default;
+
+            template <typename Fn,
+                      typename = std::enable_if_t<!std::is_same_v<std::decay_t<Fn>, LotSubmitCallback>>>
+            LotSubmitCallback(Fn &&fn)
+            : context{const_cast<void *>(static_cast<const void *>(&fn))},
+              invoke{[](void *context) { (*static_cast<std::remove_reference_t<Fn> *>(context))(); }} {}
+
+            explicit operator bool() const { return invoke != nullptr; }
+            void operator()() const { invoke(context); }
+
+        private:
+            void *context = nullptr;
+            void (*invoke)(void *) = nullptr;
+    };
 
-            LotSwapChain(LotDevice &deviceRef, VkExtent2D extent);
-            LotSwapChain(LotDevice &deviceRef, VkExtent2D extent, std::shared_ptr<LotSwapChain> previous);
+    class LotSwapChain {
+        public:
+            // 프레임 슬롯별 자원 배열의 크기 (실제 동시 진행 프레임 수는 Config::framesInFlight)
+            static constexpr int MAX_FRAMES_IN_FLIGHT = 4;
+            static constexpr uint32_t DEFAULT_FRAMES_IN_FLIGHT = 2;
+
+            struct Config {
+                // Auto: MAILBOX를 지원하면 MAILBOX, 아니면 FIFO
+                // 요청한 모드를 지원하지 않으면 항상 지원되는 FIFO로 대체
+                enum class PresentMode { Auto, Immediate, Mailbox, Fifo, FifoRelaxed };
+
+                PresentMode presentMode{PresentMode::Auto};
+                // 스왑체인 이미지 수 (0이면 minImageCount + 1, 표면이 허용하는 범위로 제한)
+                uint32_t imageCount{0};
+                // CPU가 GPU보다 앞서 기록할 수 있는 프레임 수 (1 ~ MAX_FRAMES_IN_FLIGHT)
+                // GPU가 병목인 제한 없는 벤치마크는 3 이상으로 올려 CPU 대기를 줄일 수 있음
+                uint32_t framesInFlight{DEFAULT_FRAMES_IN_FLIGHT};
+            };
+
+            // 깊이 이미지가 바인딩된 메모리 (교체된 스왑체인에서 회수해 다음 스왑체인이 재사용할 수 있도록 크기와 타입을 보관)
+            struct DepthAllocation {
+                VkDeviceMemory memory = VK_NULL_HANDLE;
+                VkDeviceSize size = 0;
+                uint32_t memoryTypeIndex = 0;
+            };
+
+            static const char *presentModeName(Config::PresentMode mode);
+            // 1 ~ MAX_FRAMES_IN_FLIGHT로 제한한 값
+            static uint32_t clampFramesInFlight(uint32_t framesInFlight);
+
+            LotSwapChain(LotDevice &deviceRef, VkExtent2D extent, const Config &config);
+            // previous를 oldSwapchain으로 넘겨 교체 (유휴 대기 없음)
+            // 포맷이 같으면 렌더 패스를 넘겨받고, 깊이 버퍼는 spareDepthAllocations에서 크기/타입이 맞는 메모리를 꺼내 씀
+            // (previous의 깊이 메모리는 그 프레임이 끝난 뒤 releaseDepthAllocations로 회수)
+            // 프레임 슬롯 번호를 이어받으므로 previous의 같은 슬롯 펜스가 같은 커맨드 버퍼의 이전 제출을 가리킴
+            LotSwapChain(LotDevice &deviceRef, VkExtent2D extent, const Config &config,
+                         std::shared_ptr<LotSwapChain> previous, std::vector<DepthAllocation> &spareDepthAllocations);
             ~LotSwapChain();
 
             LotSwapChain(const LotSwapChain &) = delete;
@@ -29,6 +81,8 @@ namespace lot {
             VkExtent2D getSwapChainExtent() { return swapChainExtent; }
             uint32_t width() { return swapChainExtent.width; }
             uint32_t height() { return swapChainExtent.height; }
+            uint32_t getFramesInFlight() const { return framesInFlight; }
+            VkPresentModeKHR getPresentMode() const { return presentMode; }
 
             float extentAspectRatio() {
                 return static_cast<float>(swapChainExtent.width) / static_cast<float>(swapChainExtent.height);
@@ -37,14 +91,26 @@ namespace lot {
             VkFormat findDepthFormat();
 
             VkResult acquireNextImage(uint32_t *imageIndex);
-            VkResult submitCommandBuffers(const VkCommandBuffer *buffers, uint32_t *imageIndex);
+            // beforeSubmit은 이미지 펜스 대기 후 vkQueueSubmit 직전에 호출 (late latch: 최신 카메라 쓰기)
+            VkResult submitCommandBuffers(const VkCommandBuffer *buffers, uint32_t *imageIndex,
+                                          LotSubmitCallback beforeSubmit = {});
 
             bool compareSwapFormats(const LotSwapChain& swapChain) const {
                 return swapChain.swapChainDepthFormat == swapChainDepthFormat &&
                        swapChain.swapChainImageFormat == swapChainImageFormat;
             }
 
+            // 교체된 스왑체인용: 이 스왑체인으로 제출한 frameIndex 슬롯의 마지막 프레임이 끝날 때까지 대기
+            void waitForFrameFence(uint32_t frameIndex);
+            // 이 스왑체인으로 제출한 프레임이 모두 끝났는지 (대기하지 않음)
+            bool isIdle();
+            // 교체된 스왑체인용: isIdle()일 때만 호출. 깊이 이미지를 파괴하고 메모리를 돌려줌 (두 번째 호출부터는 빈 목록)
+            std::vector<DepthAllocation> releaseDepthAllocations();
+
         private:
+            // 새로 할당할 때는 가로/세로를 이 단위로 올림한 크기만큼 잡아 조금 커지는 리사이즈도 회수한 메모리로 흡수
+            static constexpr uint32_t DEPTH_SIZE_BUCKET = 256;
+
             void init();
             void createSwapChain();
             void createImageViews();
@@ -52,6 +118,7 @@ namespace lot {
             void createRenderPass();
             void createFramebuffers();
             void createSyncObjects();
+            DepthAllocation allocateDepthMemory(const VkMemoryRequirements &requirements);
 
             // Helper functions
             VkSurfaceFormatKHR chooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR> &availableFormats);
@@ -63,19 +130,24 @@ namespace lot {
             VkExtent2D swapChainExtent;
 
             std::vector<VkFramebuffer> swapChainFramebuffers;
-            VkRenderPass renderPass;
+            VkRenderPass renderPass = VK_NULL_HANDLE;
 
             std::vector<VkImage> depthImages;
-            std::vector<VkDeviceMemory> depthImageMemorys;
+            std::vector<DepthAllocation> depthAllocations;
             std::vector<VkImageView> depthImageViews;
             std::vector<VkImage> swapChainImages;
             std::vector<VkImageView> swapChainImageViews;
 
             LotDevice &device;
             VkExtent2D windowExtent;
+            Config config;
+            uint32_t framesInFlight;
+            VkPresentModeKHR presentMode = VK_PRESENT_MODE_FIFO_KHR;
 
-            VkSwapchainKHR swapChain;
+            VkSwapchainKHR swapChain = VK_NULL_HANDLE;
+            // 생성 중에만 유지 (자원을 넘겨받은 뒤 해제)
             std::shared_ptr<LotSwapChain> oldSwapChain;
+            std::vector<DepthAllocation> *spareDepthAllocations = nullptr;
 
             std::vector<VkSemaphore> imageAvailableSemaphores;
             std::vector<VkSemaphore> renderFinishedSemaphores;
@@ -0,0 +1,57 @@
+#include "lot_thread_command_pools.h"
+#include "lot_flight_recorder.h"
+
+// std
+#include <stdexcept>
+
+namespace lot {
+    LotThreadCommandPools::LotThreadCommandPools(LotDevice &device, uint32_t threadSlotCount,
+                                                 VkCommandPoolCreateFlags flags)
+    : lotDevice{device}, threadSlotCount{threadSlotCount} {
+        for (auto &pools : framePools) {
+            pools.resize(threadSlotCount);
+            for (auto &pool : pools) {
+                // 풀 전체를 리셋하므로 개별 버퍼 리셋 플래그는 필요 없음
+                pool.commandPool = lotDevice.createGraphicsCommandPool(flags);
+            }
+        }
+    }
+
+    LotThreadCommandPools::~LotThreadCommandPools() {
+        for (auto &pools : framePools) {
+            for (auto &pool : pools) {
+                // 풀을 파괴하면 할당된 커맨드 버퍼도 함께 해제됨
+                vkDestroyCommandPool(lotDevice.device(), pool.commandPool, nullptr);
+            }
+        }
+    }
+
+    void LotThreadCommandPools::resetFrame(int frameIndex) {
+        for (auto &pool : framePools[frameIndex]) {
+            if (pool.usedBuffers == 0) continue;
+            vkResetCommandPool(lotDevice.device(), pool.commandPool, 0);
+            pool.usedBuffers = 0;
+        }
+    }
+
+    VkCommandBuffer LotThreadCommandPools::allocateSecondary(int frameIndex, uint32_t threadSlot) {
+        ThreadPool &pool = framePools[frameIndex][threadSlot];
+
+        if (pool.usedBuffers == pool.secondaryBuffers.size()) {
+            VkCommandBufferAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocInfo.commandPool = pool.commandPool;
+            allocInfo.commandBufferCount = 1;
+
+            VkCommandBuffer commandBuffer;
+            LotFlightRecorder::countVulkanCall(LotVulkanCall::AllocateCommandBuffers);
+            if (vkAllocateCommandBuffers(lotDevice.device(), &allocInfo, &commandBuffer) != VK_SUCCESS) {
+                throw std::runtime_error("failed to allocate secondary command buffer!");
+            }
+            pool.secondaryBuffers.push_back(commandBuffer);
+        }
+
+        return pool.secondaryBuffers[pool.usedBuffers++];
+    }
+} // namespace lot
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "lot_device.h"
+#include "lot_swap_chain.h"
+
+#include <array>
+#include <vector>
+
+namespace lot {
+    // 스레드 슬롯 x 프레임(MAX_FRAMES_IN_FLIGHT) 마다 하나씩 커맨드 풀을 두는 보조 커맨드 버퍼 할당기
+    // 커맨드 풀은 외부 동기화가 필요하므로 한 풀은 항상 한 스레드 슬롯에서만 사용된다.
+    class LotThreadCommandPools {
+        public:
+            // 매 프레임 다시 기록하는 용도면 VK_COMMAND_POOL_CREATE_TRANSIENT_BIT 지정
+            LotThreadCommandPools(LotDevice &device, uint32_t threadSlotCount, VkCommandPoolCreateFlags flags);
+            ~LotThreadCommandPools();
+
+            LotThreadCommandPools(const LotThreadCommandPools &) = delete;
+            LotThreadCommandPools &operator=(const LotThreadCommandPools &) = delete;
+
+            // 해당 프레임의 펜스를 기다린 뒤 호출: 그 프레임의 풀을 모두 리셋 (할당했던 버퍼는 재사용)
+            void resetFrame(int frameIndex);
+
+            // threadSlot을 소유한 스레드에서만 호출 (LotJobSystem::currentThreadSlot)
+            VkCommandBuffer allocateSecondary(int frameIndex, uint32_t threadSlot);
+
+            uint32_t getThreadSlotCount() const { return threadSlotCount; }
+
+        private:
+            struct ThreadPool {
+                VkCommandPool commandPool = VK_NULL_HANDLE;
+                std::vector<VkCommandBuffer> secondaryBuffers;
+                uint32_t usedBuffers = 0;
+            };
+
+            LotDevice &lotDevice;
+            uint32_t threadSlotCount;
+            std::array<std::vector<ThreadPool>, LotSwapChain::MAX_FRAMES_IN_FLIGHT> framePools;
+    };
+} // namespace lot
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace lot {
+    // 단일 생산자/단일 소비자용 lock-free 트리플 버퍼
+    // - 생산자는 back 슬롯에 쓰고 publish()로 middle 슬롯과 교환
+    // - 소비자는 acquire()로 가장 최신 middle 슬롯을 front로 가져감
+    // 어느 쪽도 다른 쪽을 기다리지 않으며, 소비자가 느리면 중간 프레임은 덮어써진다.
+    template <typename T>
+    class LotTripleBuffer {
+        public:
+            LotTripleBuffer() = default;
+
+            LotTripleBuffer(const LotTripleBuffer &) = delete;
+            LotTripleBuffer &operator=(const LotTripleBuffer &) = delete;
+
+            // 생산자 전용
+            T& writeBuffer() { return buffers[backIndex]; }
+
+            void publish() {
+                uint8_t previous = middle.exchange(
+                    static_cast<uint8_t>(backIndex | DIRTY_BIT), std::memory_order_acq_rel);
+                backIndex = previous & INDEX_MASK;
+            }
+
+            // 소비자가 아직 가져가지 않은 스냅샷이 있는지 (생산자 페이싱용)
+            bool hasPending() const {
+                return (middle.load(std::memory_order_acquire) & DIRTY_BIT) != 0;
+            }
+
+            // 소비자 전용: 새 데이터가 있으면 front와 교환 후 true
+            bool acquire() {
+                if ((middle.load(std::memory_order_acquire) & DIRTY_BIT) == 0) {
+                    return false;
+                }
+                uint8_t previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+                frontIndex = previous & INDEX_MASK;
+                return true;
+            }
+
+            const T& readBuffer() const { return buffers[frontIndex]; }
+
+        private:
+            static constexpr uint8_t DIRTY_BIT = 0x4;
+            static constexpr uint8_t INDEX_MASK = 0x3;
+
+            std::array<T, 3> buffers{};
+
+            // 생산자/소비자 인덱스를 서로 다른 캐시 라인에 배치 (false sharing 방지)
+            alignas(64) uint8_t backIndex{0};
+            alignas(64) std::atomic<uint8_t> middle{1};
+            alignas(64) uint8_t frontIndex{2};
+    };
+} // namespace lot
@@ -157,7 +157,8 @@
 
 namespace lot {
     LotWindow::LotWindow(int w, int h, std::string name) 
-    : width{w}, height{h}, windowName{name} {
+    : windowName{name} {
+        setExtent(w, h);
         initWindow();
     }
 
@@ -192,7 +193,9 @@ namespace lot {
         glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
         glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
 
-        window = glfwCreateWindow(width, height, windowName.c_str(), nullptr, nullptr);
+        VkExtent2D initialExtent = getExtent();
+        window = glfwCreateWindow(static_cast<int>(initialExtent.width), static_cast<int>(initialExtent.height),
+                                  windowName.c_str(), nullptr, nullptr);
         glfwSetWindowUserPointer(window, this);
         glfwSetFramebufferSizeCallback(window, framebufferResizeCallback);
 
@@ -226,8 +229,8 @@ namespace lot {
 
     void LotWindow::framebufferResizeCallback(GLFWwindow *window, int width, int height) {
         auto lotWindow = reinterpret_cast<LotWindow *>(glfwGetWindowUserPointer(window));
+        // 크기를 먼저 저장해야 플래그를 본 렌더 스레드가 새 크기를 읽음
+        lotWindow->setExtent(width, height);
         lotWindow->framebufferResized = true;
-        lotWindow->width = width;
-        lotWindow->height = height;
     }
 } // namespace lot
\ No newline at end of file
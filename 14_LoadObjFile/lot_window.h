@@ -2,6 +2,9 @@
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
+
+#include <atomic>
+#include <cstdint>
 #include <string>
 
 namespace lot {
@@ -16,11 +19,15 @@ namespace lot {
             bool shouldClose() { return glfwWindowShouldClose(window); }
 
             VkExtent2D getExtent() {
-                return { static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+                uint64_t packed = extent.load(std::memory_order_acquire);
+                return { static_cast<uint32_t>(packed >> 32), static_cast<uint32_t>(packed) };
             }
             bool wasWindowReSized() { return framebufferResized; }
             void resetWindowResizedFlag() { framebufferResized = false; }
             GLFWwindow* getGLFWwindow() { return window; }
+            // 메인 스레드 전용 (GLFW 창 속성 조회)
+            bool isFocused() { return glfwGetWindowAttrib(window, GLFW_FOCUSED) == GLFW_TRUE; }
+            bool isMinimized() { return glfwGetWindowAttrib(window, GLFW_ICONIFIED) == GLFW_TRUE; }
 
             void createWindowSurface(VkInstance instance, VkSurfaceKHR *surfacec_);
 
@@ -30,14 +37,18 @@ namespace lot {
         private:
             static void framebufferResizeCallback(GLFWwindow *window, int width, int height);
             void initWindow();
+            void setExtent(int width, int height) {
+                extent.store((static_cast<uint64_t>(static_cast<uint32_t>(width)) << 32) | static_cast<uint32_t>(height),
+                             std::memory_order_release);
+            }
 
-            int width;
-            int height;
-            bool framebufferResized = false;
+            // 렌더 스레드에서도 읽으므로 atomic. 너비와 높이가 따로 읽히지 않게 상위/하위 32비트에 함께 저장
+            std::atomic<uint64_t> extent{0};
+            std::atomic<bool> framebufferResized{false};
 
             std::string windowName;
             GLFWwindow *window;
 
-            bool userResizing = false;
+            std::atomic<bool> userResizing{false};
     };
 }
\ No newline at end of file
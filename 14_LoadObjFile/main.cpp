@@ -4,17 +4,102 @@
 
 #include "first_app.h"
 
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
-int main() {
-  lot::FirstApp app{};
+static const char *const USAGE =
+    " [--headless] [--frames N] [--size WxH]"
+    " [--bench] [--bench-objects N] [--bench-shape cube|vase] [--bench-layout grid|random]"
+    " [--bench-rotate] [--bench-select F] [--bench-seed N] [--bench-report PATH]"
+    " [--record-input PATH | --replay-input PATH [--replay-timestep SEC]] [--on-demand]"
+    " [--present-mode immediate|mailbox|fifo|fifo-relaxed] [--swapchain-images N] [--frames-in-flight N]"
+    " [--max-queued-frames N] [--fps-cap FPS] [--no-late-latch]\n";
+
+// 사용법: VulkanApp [--headless] [--frames N] [--size WxH] [--bench ...] [--record-input PATH] [--replay-input PATH]
+// --bench-* 옵션은 --bench와 함께 쓰며, --frames는 측정 프레임 수로 사용됨
+// --replay-input은 기록한 입력을 고정 간격(기본 1/60초)으로 재생하고 끝나면 종료
+// --on-demand는 화면에 변화가 있을 때만 렌더링 (유휴 상태에서는 이벤트를 기다림)
+// 낮은 입력 지연: --present-mode mailbox --frames-in-flight 1 --max-queued-frames 1
+// 벤치마크 (제한 없음): --present-mode immediate (GPU가 병목이면 --frames-in-flight 3, 최대 4)
+int main(int argc, char **argv) {
+  lot::FirstAppOptions options{};
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--headless") {
+      options.headless = true;
+    } else if (arg == "--frames" && i + 1 < argc) {
+      options.headlessFrames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--size" && i + 1 < argc &&
+               std::sscanf(argv[++i], "%ux%u", &options.headlessExtent.width, &options.headlessExtent.height) == 2) {
+      continue;
+    } else if (arg == "--bench") {
+      options.benchmark = true;
+    } else if (arg == "--bench-objects" && i + 1 < argc) {
+      options.benchmarkConfig.objectCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--bench-shape" && i + 1 < argc &&
+               (std::string{argv[i + 1]} == "cube" || std::string{argv[i + 1]} == "vase")) {
+      options.benchmarkConfig.shape = std::string{argv[++i]} == "vase" ? lot::LotBenchmarkConfig::Shape::Vase
+                                                                       : lot::LotBenchmarkConfig::Shape::Cube;
+    } else if (arg == "--bench-layout" && i + 1 < argc &&
+               (std::string{argv[i + 1]} == "grid" || std::string{argv[i + 1]} == "random")) {
+      options.benchmarkConfig.layout = std::string{argv[++i]} == "random" ? lot::LotBenchmarkConfig::Layout::Random
+                                                                          : lot::LotBenchmarkConfig::Layout::Grid;
+    } else if (arg == "--bench-rotate") {
+      options.benchmarkConfig.rotating = true;
+    } else if (arg == "--bench-select" && i + 1 < argc) {
+      options.benchmarkConfig.selectionFraction = std::strtof(argv[++i], nullptr);
+    } else if (arg == "--bench-seed" && i + 1 < argc) {
+      options.benchmarkConfig.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--bench-report" && i + 1 < argc) {
+      options.benchmarkConfig.reportPath = argv[++i];
+    } else if (arg == "--record-input" && i + 1 < argc) {
+      options.recordInputPath = argv[++i];
+    } else if (arg == "--replay-input" && i + 1 < argc) {
+      options.replayInputPath = argv[++i];
+    } else if (arg == "--replay-timestep" && i + 1 < argc) {
+      options.replayTimestep = std::strtof(argv[++i], nullptr);
+    } else if (arg == "--on-demand") {
+      options.renderOnDemand = true;
+    } else if (arg == "--present-mode" && i + 1 < argc) {
+      using PresentMode = lot::LotSwapChain::Config::PresentMode;
+      std::string mode = argv[++i];
+      if (mode == "immediate") {
+        options.swapChainConfig.presentMode = PresentMode::Immediate;
+      } else if (mode == "mailbox") {
+        options.swapChainConfig.presentMode = PresentMode::Mailbox;
+      } else if (mode == "fifo") {
+        options.swapChainConfig.presentMode = PresentMode::Fifo;
+      } else if (mode == "fifo-relaxed") {
+        options.swapChainConfig.presentMode = PresentMode::FifoRelaxed;
+      } else {
+        std::cerr << "usage: " << argv[0] << USAGE;
+        return EXIT_FAILURE;
+      }
+    } else if (arg == "--swapchain-images" && i + 1 < argc) {
+      options.swapChainConfig.imageCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--frames-in-flight" && i + 1 < argc) {
+      options.swapChainConfig.framesInFlight = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--max-queued-frames" && i + 1 < argc) {
+      options.framePacerConfig.maxQueuedFrames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--fps-cap" && i + 1 < argc) {
+      options.framePacerConfig.maxFps = std::strtof(argv[++i], nullptr);
+    } else if (arg == "--no-late-latch") {
+      options.lateLatchCamera = false;
+    } else {
+      std::cerr << "usage: " << argv[0] << USAGE;
+      return EXIT_FAILURE;
+    }
+  }
 
   try {
+    lot::FirstApp app{options};
     app.run();
   } catch (const std::exception &e) {
     std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
   }
   return EXIT_SUCCESS;
 }
\ No newline at end of file
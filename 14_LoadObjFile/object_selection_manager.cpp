@@ -1,39 +1,44 @@
 #include "object_selection_manager.h"
+#include "lot_cpu_profiler.h"
+#include "lot_frame_arena.h"
+#include "lot_job_system.h"
+#include "lot_log.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <limits>
-#include <iostream>
 
 namespace lot {
+    // 레이-메시 검사에서 잡 하나가 처리하는 최소 삼각형 수
+    static constexpr size_t TRIANGLE_GRAIN_SIZE = 1024;
 
-    void ObjectSelectionManager::handleMouseClick(GLFWwindow* window,
+    void ObjectSelectionManager::handleMouseClick(LotInput& input,
                                                 const LotCamera& camera,
                                                 std::vector<LotGameObject>& gameObjects) {
 
         // 카메라 저장 (투영 계산에 필요)
         currentCamera = &camera;
 
-        int leftState = glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_LEFT);
-
-        if (leftState == GLFW_PRESS && !leftMousePressed) {
-            leftMousePressed = true;
+        // 누른 프레임에만 선택 (프레임 사이의 짧은 클릭도 에지로 남음)
+        if (input.isActionPressed(LotInputAction::PickObject)) {
+            LOT_PROFILE_SCOPE("ObjectSelectionManager::pick");
 
             double mouseX, mouseY;
-            glfwGetCursorPos(window, &mouseX, &mouseY);
+            input.getCursorPos(mouseX, mouseY);
 
             // 마우스 좌표 저장
             lastMouseX = mouseX;
             lastMouseY = mouseY;
 
-            glfwGetWindowSize(window, &windowWidth, &windowHeight);
+            input.getWindowSize(windowWidth, windowHeight);
 
             Ray ray = screenToWorldRay(mouseX, mouseY, windowWidth, windowHeight, camera);
             LotGameObject* hitObject = findIntersectedObject(ray, gameObjects);
 
-            bool ctrlPressed = glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS ||
-                              glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS;
+            bool ctrlPressed = input.isActionDown(LotInputAction::ToggleSelectionModifier);
 
             if (hitObject != nullptr) {
                 if (ctrlPressed) {
@@ -49,16 +54,20 @@ namespace lot {
             } else if (!ctrlPressed) {
                 clearAllSelections(gameObjects);
             }
-        } else if (leftState == GLFW_RELEASE) {
-            leftMousePressed = false;
         }
     }
 
     void ObjectSelectionManager::clearAllSelections(std::vector<LotGameObject>& gameObjects) {
+        bool changed = !selectedObjectIds.empty();
         for (auto& obj : gameObjects) {
+            changed = changed || obj.isSelected;
             obj.isSelected = false;
         }
         selectedObjectIds.clear();
+
+        if (changed) {
+            selectionVersion++;
+        }
     }
 
     bool ObjectSelectionManager::isObjectSelected(const LotGameObject& object) const {
@@ -74,6 +83,9 @@ namespace lot {
 
         for (auto& obj : gameObjects) {
             if (obj.getId() == objectId) {
+                if (!obj.isSelected) {
+                    selectionVersion++;
+                }
                 obj.isSelected = true;
                 selectedObjectIds.insert(objectId);
                 break;
@@ -85,6 +97,9 @@ namespace lot {
                                               std::vector<LotGameObject>& gameObjects) {
         for (auto& obj : gameObjects) {
             if (obj.getId() == objectId) {
+                if (obj.isSelected) {
+                    selectionVersion++;
+                }
                 obj.isSelected = false;
                 selectedObjectIds.erase(objectId);
                 break;
@@ -247,31 +262,45 @@ namespace lot {
         // 마우스 위치 (화면 좌표)
         glm::vec2 mouseScreenPos = glm::vec2(lastMouseX, lastMouseY);
 
+        // 객체별 교차 검사는 서로 독립적이므로 병렬로 수행하고, 결과 비교는 순서대로 진행
+        const float NO_HIT = std::numeric_limits<float>::max();
+        // 질의마다 쓰고 버리는 배열이므로 스레드 스크래치 아레나에 둠 (병렬 작업은 쓰기만 함)
+        LotScratchScope scratch;
+        std::pmr::vector<float> hitDistances(gameObjects.size(), NO_HIT, scratch.resource());
 
-        for (auto& obj : gameObjects) {
-            if (!obj.model) continue;
+        LotJobSystem::instance().parallelFor(gameObjects.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const auto& obj = gameObjects[i];
+                if (!obj.model) continue;
 
-            bool isSelected = false;
-            float intersectionDistance = 0.0f;
+                bool isSelected = false;
+                float intersectionDistance = 0.0f;
 
-            // 복잡한 메시인 경우 정밀한 레이-메시 교차 검사
-            if (hasComplexGeometry(obj)) {
-                isSelected = rayIntersectsMesh(ray, obj, intersectionDistance);
-            }
-            // 단순한 객체(큐브 등)도 레이-바운딩박스 교차 검사 사용
-            else {
-                BoundingBox bbox = calculateBoundingBox(obj);
-                isSelected = rayIntersectsBoundingBoxWithDistance(ray, bbox, intersectionDistance);
+                // 복잡한 메시인 경우 정밀한 레이-메시 교차 검사
+                if (hasComplexGeometry(obj)) {
+                    isSelected = rayIntersectsMesh(ray, obj, intersectionDistance);
+                }
+                // 단순한 객체(큐브 등)도 레이-바운딩박스 교차 검사 사용
+                else {
+                    BoundingBox bbox = calculateBoundingBox(obj);
+                    isSelected = rayIntersectsBoundingBoxWithDistance(ray, bbox, intersectionDistance);
+                }
+
+                if (isSelected) {
+                    hitDistances[i] = intersectionDistance;
+                }
             }
+        });
 
-            if (isSelected) {
-                // 선택 점수는 교차 거리로 계산
-                float selectionScore = intersectionDistance;
+        for (size_t i = 0; i < gameObjects.size(); i++) {
+            if (hitDistances[i] == NO_HIT) continue;
 
-                if (selectionScore < bestSelectionScore) {
-                    bestSelectionScore = selectionScore;
-                    closestObject = &obj;
-                }
+            // 선택 점수는 교차 거리로 계산
+            float selectionScore = hitDistances[i];
+
+            if (selectionScore < bestSelectionScore) {
+                bestSelectionScore = selectionScore;
+                closestObject = &gameObjects[i];
             }
         }
 
@@ -315,9 +344,7 @@ namespace lot {
         // 화면상 반지름 (거리에 반비례) - 적절한 크기로 조정
         float screenRadius = (worldSize * 200.0f) / distance;
 
-        // 디버그 출력
-        std::cout << "    Radius calc: worldSize=" << worldSize << ", distance=" << distance
-                  << ", calculated=" << screenRadius << std::endl;
+        LOT_LOG_DEBUG("Radius calc: worldSize={}, distance={}, calculated={}", worldSize, distance, screenRadius);
 
         // 최소/최대 반지름 제한 (적절한 크기로 설정)
         return glm::clamp(screenRadius, 30.0f, 80.0f);
@@ -329,7 +356,7 @@ namespace lot {
         }
 
         // 3D 바운딩박스의 8개 꼭짓점 생성
-        std::vector<glm::vec3> corners = {
+        std::array<glm::vec3, 8> corners = {{
             {bbox.min.x, bbox.min.y, bbox.min.z},
             {bbox.max.x, bbox.min.y, bbox.min.z},
             {bbox.min.x, bbox.max.y, bbox.min.z},
@@ -338,7 +365,7 @@ namespace lot {
             {bbox.max.x, bbox.min.y, bbox.max.z},
             {bbox.min.x, bbox.max.y, bbox.max.z},
             {bbox.max.x, bbox.max.y, bbox.max.z}
-        };
+        }};
 
         float minScreenX = std::numeric_limits<float>::max();
         float maxScreenX = std::numeric_limits<float>::lowest();
@@ -349,8 +376,8 @@ namespace lot {
         for (size_t i = 0; i < corners.size(); ++i) {
             glm::vec2 screenPos = projectToScreen(corners[i], {});
 
-            std::cout << "    Corner " << i << " world(" << corners[i].x << "," << corners[i].y << "," << corners[i].z
-                      << ") -> screen(" << screenPos.x << "," << screenPos.y << ")" << std::endl;
+            LOT_LOG_DEBUG("Corner {} world({},{},{}) -> screen({},{})",
+                          i, corners[i].x, corners[i].y, corners[i].z, screenPos.x, screenPos.y);
 
             minScreenX = std::min(minScreenX, screenPos.x);
             maxScreenX = std::max(maxScreenX, screenPos.x);
@@ -433,35 +460,41 @@ namespace lot {
             return rayIntersectsBoundingBoxWithDistance(ray, calculateBoundingBox(obj), distance);
         }
 
-        float closestDistance = std::numeric_limits<float>::max();
-        bool hitFound = false;
-
-        // 모든 삼각형 검사
-        for (size_t i = 0; i < indices.size(); i += 3) {
-            // 삼각형 버텍스 가져오기
-            glm::vec3 v0 = vertices[indices[i]].position;
-            glm::vec3 v1 = vertices[indices[i + 1]].position;
-            glm::vec3 v2 = vertices[indices[i + 2]].position;
-
-            // 객체의 트랜스폼 적용
-            glm::mat4 modelMatrix = obj.transform.mat4();
-            v0 = glm::vec3(modelMatrix * glm::vec4(v0, 1.0f));
-            v1 = glm::vec3(modelMatrix * glm::vec4(v1, 1.0f));
-            v2 = glm::vec3(modelMatrix * glm::vec4(v2, 1.0f));
-
-            // 레이-삼각형 교차 검사
-            Triangle tri = {v0, v1, v2};
-            float t;
-            if (rayIntersectsTriangle(ray, tri, t)) {
-                if (t < closestDistance) {
-                    closestDistance = t;
-                    hitFound = true;
+        // 객체의 트랜스폼은 삼각형마다 같으므로 한 번만 계산
+        const glm::mat4 modelMatrix = obj.transform.mat4();
+        const size_t triangleCount = indices.size() / 3;
+
+        // 삼각형 구간별로 병렬 검사 후 가장 가까운 거리만 원자적으로 갱신
+        std::atomic<float> closestDistance{std::numeric_limits<float>::max()};
+
+        LotJobSystem::instance().parallelFor(triangleCount, TRIANGLE_GRAIN_SIZE, [&](size_t begin, size_t end) {
+            float localClosest = std::numeric_limits<float>::max();
+
+            for (size_t tri = begin; tri < end; tri++) {
+                size_t i = tri * 3;
+
+                // 삼각형 버텍스 가져오기 및 트랜스폼 적용
+                glm::vec3 v0 = glm::vec3(modelMatrix * glm::vec4(vertices[indices[i]].position, 1.0f));
+                glm::vec3 v1 = glm::vec3(modelMatrix * glm::vec4(vertices[indices[i + 1]].position, 1.0f));
+                glm::vec3 v2 = glm::vec3(modelMatrix * glm::vec4(vertices[indices[i + 2]].position, 1.0f));
+
+                // 레이-삼각형 교차 검사
+                Triangle triangle = {v0, v1, v2};
+                float t;
+                if (rayIntersectsTriangle(ray, triangle, t) && t < localClosest) {
+                    localClosest = t;
                 }
             }
-        }
 
-        if (hitFound) {
-            distance = closestDistance;
+            float current = closestDistance.load(std::memory_order_relaxed);
+            while (localClosest < current &&
+                   !closestDistance.compare_exchange_weak(current, localClosest, std::memory_order_relaxed)) {
+            }
+        });
+
+        float result = closestDistance.load(std::memory_order_relaxed);
+        if (result < std::numeric_limits<float>::max()) {
+            distance = result;
             return true;
         }
 
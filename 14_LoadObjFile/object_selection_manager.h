@@ -2,7 +2,7 @@
 
 #include "lot_game_object.h"
 #include "lot_camera.h"
-#include "lot_window.h"
+#include "lot_input.h"
 
 #include <glm/glm.hpp>
 #include <vector>
@@ -32,7 +32,7 @@ namespace lot {
             glm::vec3 v0, v1, v2;
         };
 
-        void handleMouseClick(GLFWwindow* window,
+        void handleMouseClick(LotInput& input,
                             const LotCamera& camera,
                             std::vector<LotGameObject>& gameObjects);
 
@@ -44,6 +44,9 @@ namespace lot {
             return selectedObjectIds;
         }
 
+        // 선택 상태가 바뀔 때마다 증가 (렌더 캐시 무효화용)
+        uint64_t getSelectionVersion() const { return selectionVersion; }
+
         void selectObject(LotGameObject::id_t objectId,
                          std::vector<LotGameObject>& gameObjects,
                          bool multiSelect = false);
@@ -51,17 +54,24 @@ namespace lot {
         void deselectObject(LotGameObject::id_t objectId,
                           std::vector<LotGameObject>& gameObjects);
 
+        // 교차 검사 (선택 상태를 쓰지 않으므로 정적, lot_bench에서 직접 측정)
+        static bool rayIntersectsBoundingBox(const Ray& ray, const BoundingBox& bbox);
+
+        static bool rayIntersectsBoundingBoxWithDistance(const Ray& ray, const BoundingBox& bbox, float& distance);
+
+        static BoundingBox calculateBoundingBox(const LotGameObject& object);
+
+        static bool rayIntersectsTriangle(const Ray& ray, const Triangle& triangle, float& t);
+
+        static bool rayIntersectsMesh(const Ray& ray, const LotGameObject& obj, float& distance);
+
+        static bool hasComplexGeometry(const LotGameObject& obj);
+
     private:
         Ray screenToWorldRay(double mouseX, double mouseY,
                            int windowWidth, int windowHeight,
                            const LotCamera& camera);
 
-        bool rayIntersectsBoundingBox(const Ray& ray, const BoundingBox& bbox);
-
-        bool rayIntersectsBoundingBoxWithDistance(const Ray& ray, const BoundingBox& bbox, float& distance);
-
-        BoundingBox calculateBoundingBox(const LotGameObject& object);
-
         LotGameObject* findIntersectedObject(const Ray& ray,
                                            std::vector<LotGameObject>& gameObjects);
 
@@ -76,14 +86,8 @@ namespace lot {
 
         bool isPointInsideRect(const glm::vec2& point, const ScreenRect& rect);
 
-        bool rayIntersectsTriangle(const Ray& ray, const Triangle& triangle, float& t);
-
-        bool rayIntersectsMesh(const Ray& ray, const LotGameObject& obj, float& distance);
-
-        bool hasComplexGeometry(const LotGameObject& obj);
-
         std::set<LotGameObject::id_t> selectedObjectIds;
-        bool leftMousePressed = false;
+        uint64_t selectionVersion = 0;
         double lastMouseX = 0.0;
         double lastMouseY = 0.0;
         const LotCamera* currentCamera = nullptr;
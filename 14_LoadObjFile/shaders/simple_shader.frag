@@ -1,19 +1,22 @@
 #version 450
 
 layout (location = 0) in vec3 fragColor;
+layout (location = 1) flat in int fragSelected;  // 선택 상태를 나타내는 플래그
 layout (location = 0) out vec4 outColor;
 
-layout(push_constant) uniform Push {
-    mat4 transform;
-    vec3 color;
-    int isSelected;  // 선택 상태를 나타내는 플래그
-} push;
+// 하이라이트 외곽선 파이프라인에서만 VK_TRUE로 특수화됨
+layout (constant_id = 0) const bool OUTLINE_PASS = false;
 
 void main(){
+    if (OUTLINE_PASS) {
+        outColor = vec4(1.0, 0.5, 0.0, 1.0);  // 주황색 하이라이트
+        return;
+    }
+
     vec3 baseColor = fragColor;
 
     // 선택된 객체라면 하이라이트 효과 적용
-    if (push.isSelected == 1) {
+    if (fragSelected == 1) {
         // 밝은 노란색 테두리 효과
         vec3 highlightColor = vec3(1.0, 1.0, 0.0);  // 노란색
         // 기본 색상과 하이라이트 색상을 섞어서 밝게 만들기
@@ -4,14 +4,37 @@ layout(location = 0) in vec3 position;
 layout(location = 1) in vec3 color;
 
 layout(location = 0) out vec3 fragColor;
+layout(location = 1) flat out int fragSelected;
 
+layout(set = 0, binding = 0) uniform GlobalUbo {
+    mat4 projection;
+    mat4 view;
+    mat4 inverseView;
+    mat4 projectionView;
+    vec4 viewportSize;   // xy: 크기, zw: 역수
+    float time;
+    float frameTime;
+    uint frameNumber;
+} ubo;
+
+struct ObjectData {
+    mat4 modelMatrix;
+    vec4 color;
+    int isSelected;
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer ObjectBuffer {
+    ObjectData objects[];
+} objectBuffer;
+
+// 드로우마다 객체 버퍼의 인덱스만 전달
 layout(push_constant) uniform Push {
-    mat4 transform;
-    vec3 color;
+    uint objectIndex;
 } push;
 
 void main() {
-    //gl_Position = vec4(positions[gl_VertexIndex], 0.0, 1.0);
-    gl_Position = push.transform * vec4(position, 1.0);
+    ObjectData object = objectBuffer.objects[push.objectIndex];
+    gl_Position = ubo.projectionView * object.modelMatrix * vec4(position, 1.0);
     fragColor = color;
+    fragSelected = object.isSelected;
 }
\ No newline at end of file
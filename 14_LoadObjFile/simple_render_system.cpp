@@ -1,4 +1,8 @@
 #include "simple_render_system.h"
+#include "lot_cpu_profiler.h"
+#include "lot_gpu_profiler.h"
+#include "lot_job_system.h"
+#include "lot_log.h"
 
 // libs
 #define GLM_FORCE_RADIANS
@@ -7,41 +11,67 @@
 #include <glm/gtc/constants.hpp>
 
 // std
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <chrono>
+#include <mutex>
 #include <stdexcept>
 #include <iostream>
 
 namespace lot {
+    // 객체 데이터는 스토리지 버퍼에 있으므로 드로우마다 인덱스만 전달
     struct SimplePushConstantData {
-        glm::mat4 transform{1.f};
-        alignas(16) glm::vec3 color;
-        alignas(4) int isSelected{0};  // 선택 상태 플래그 추가
+        uint32_t objectIndex{0};
     };
-    
 
-    SimpleRenderSystem::SimpleRenderSystem(LotDevice &device, VkRenderPass renderPass)
-    : lotDevice{device}  {
-        createPipelineLayout();
+    // 보조 커맨드 버퍼 하나에 기록하는 드로우 수
+    static constexpr size_t RECORD_GRAIN_SIZE = 1024;
+
+    SimpleRenderSystem::SimpleRenderSystem(LotDevice &device, LotPipelineManager &pipelineManager,
+                                           VkRenderPass renderPass, VkDescriptorSetLayout globalSetLayout)
+    : lotDevice{device}, pipelineManager{pipelineManager}  {
+        createPipelineLayout(globalSetLayout);
+
+        // 파이프라인 캐시 효과 확인용: 콜드(캐시 없음)/웜(캐시 적중) 생성 시간 출력
+        auto pipelineStart = std::chrono::steady_clock::now();
         createPipeline(renderPass);
-        createHighlightPipeline(renderPass);
+        auto pipelineTime = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - pipelineStart).count();
+        LOT_LOG_INFO("[PipelineCache] Created pipelines in {} ms ({} cache)",
+                     pipelineTime, lotDevice.getPipelineCache().isWarm() ? "warm" : "cold");
+
+        // 하이라이트는 첫 프레임에 없어도 되므로 백그라운드에서 컴파일 (그 전까지는 기본 파이프라인 사용)
+        requestHighlightPipeline(renderPass);
+
+        // 캐시된 보조 커맨드 버퍼는 여러 프레임에 걸쳐 재사용하므로 프레임 풀과 별도로 관리
+        uint32_t threadSlotCount = LotJobSystem::instance().getThreadSlotCount();
+        objectCachePools = std::make_unique<LotThreadCommandPools>(lotDevice, threadSlotCount, 0);
+        highlightCachePools = std::make_unique<LotThreadCommandPools>(lotDevice, threadSlotCount, 0);
     }
 
     SimpleRenderSystem::~SimpleRenderSystem() {
-        vkDeviceWaitIdle(lotDevice.device());
+        {
+            std::lock_guard<std::mutex> lock{lotDevice.queueMutex()};
+            vkDeviceWaitIdle(lotDevice.device());
+        }
+        objectCachePools.reset();
+        highlightCachePools.reset();
         vkDestroyPipelineLayout(lotDevice.device(), pipelineLayout, nullptr);
     }
 
-    void SimpleRenderSystem::createPipelineLayout() {
+    void SimpleRenderSystem::createPipelineLayout(VkDescriptorSetLayout globalSetLayout) {
         VkPushConstantRange pushConstantRange{};
-        pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+        pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
         pushConstantRange.offset = 0;
         pushConstantRange.size = sizeof(SimplePushConstantData);
 
         VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
         pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-        pipelineLayoutInfo.setLayoutCount = 0;
-        pipelineLayoutInfo.pSetLayouts = nullptr;
+        std::vector<VkDescriptorSetLayout> descriptorSetLayouts{globalSetLayout};
+
+        pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(descriptorSetLayouts.size());
+        pipelineLayoutInfo.pSetLayouts = descriptorSetLayouts.data();
         pipelineLayoutInfo.pushConstantRangeCount = 1;
         pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
         if (vkCreatePipelineLayout(lotDevice.device(), &pipelineLayoutInfo, nullptr, &pipelineLayout) != VK_SUCCESS) {
@@ -56,39 +86,176 @@ namespace lot {
         LotPipeline::defaultPipelineConfigInfo(pipelineConfig);
         pipelineConfig.renderPass = renderPass;
         pipelineConfig.pipelineLayout = pipelineLayout;
-        lotPipeline = std::make_unique<LotPipeline>(
-            lotDevice, 
-            "shaders/simple_shader.vert.spv", 
-            "shaders/simple_shader.frag.spv" ,
+        lotPipeline = &pipelineManager.createBlocking(
+            "shaders/simple_shader.vert.spv",
+            "shaders/simple_shader.frag.spv",
             pipelineConfig);
+        pipelineManager.setFallback(*lotPipeline);
     }
 
-    void SimpleRenderSystem::renderGameObjects(VkCommandBuffer commandBuffer, 
-                                               std::vector<LotGameObject> &gameObjects, const LotCamera& camera) {
-        lotPipeline->bind(commandBuffer);
-        
-        auto projectionView = camera.getProjection() * camera.getView();
+    void SimpleRenderSystem::recreatePipelines(VkRenderPass renderPass) {
+        // 이전 렌더 패스의 변형을 먼저 버려야 핸들 값이 재사용되었을 때 옛 변형을 돌려받지 않음
+        VkRenderPass oldRenderPass = lotPipeline->getRenderPass();
+        lotPipeline = nullptr;
+        highlightPipeline = nullptr;
+        pipelineManager.evictRenderPass(oldRenderPass);
 
-        for (auto& obj : gameObjects) {
-            //obj.transform.rotation.y = glm::mod(obj.transform.rotation.y + 0.0001f, glm::two_pi<float>());
-            //obj.transform.rotation.x = glm::mod(obj.transform.rotation.x + 0.00005f, glm::two_pi<float>());
+        // 기본 파이프라인은 바로 필요하므로 호출 스레드에서 만들고, 하이라이트는 다시 백그라운드 요청
+        createPipeline(renderPass);
+        requestHighlightPipeline(renderPass);
+        for (auto &cache : objectCaches) {
+            cache.valid = false;
+        }
+        for (auto &cache : highlightCaches) {
+            cache.valid = false;
+        }
+    }
 
-            SimplePushConstantData push{};
-            push.color = obj.color;
-            push.transform = projectionView * obj.transform.mat4();
-            push.isSelected = obj.isSelected ? 1 : 0;  // 선택 상태 전달
+    VkCommandBuffer SimpleRenderSystem::beginSecondaryCommandBuffer(FrameInfo &frameInfo,
+                                                                    LotThreadCommandPools &pools,
+                                                                    bool reusable) {
+        // 호출 스레드 전용 풀에서 할당하므로 풀 잠금이 필요 없음
+        uint32_t threadSlot = LotJobSystem::instance().currentThreadSlot();
+        VkCommandBuffer commandBuffer = pools.allocateSecondary(frameInfo.frameIndex, threadSlot);
 
-            vkCmdPushConstants(
-                commandBuffer, pipelineLayout,
-                VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-                0, sizeof(SimplePushConstantData), &push);
+        // 재사용할 버퍼는 스왑체인 이미지마다 바뀌는 프레임버퍼를 지정하지 않음
+        VkCommandBufferInheritanceInfo inheritanceInfo{};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = frameInfo.renderPass;
+        inheritanceInfo.subpass = 0;
+        inheritanceInfo.framebuffer = reusable ? VK_NULL_HANDLE : frameInfo.framebuffer;
+        // 프로파일러의 파이프라인 통계 쿼리가 켜진 상태에서 실행됨
+        inheritanceInfo.pipelineStatistics = LotGpuProfiler::inheritedPipelineStatistics(lotDevice);
 
-            obj.model->bind(commandBuffer);
-            obj.model->draw(commandBuffer);
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        if (!reusable) {
+            beginInfo.flags |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        }
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+            throw std::runtime_error("failed to begin recording secondary command buffer!");
+        }
+
+        // 동적 상태는 주 커맨드 버퍼에서 상속되지 않음
+        VkViewport viewport{};
+        viewport.x = 0.0f;
+        viewport.y = 0.0f;
+        viewport.width = static_cast<float>(frameInfo.extent.width);
+        viewport.height = static_cast<float>(frameInfo.extent.height);
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 1.0f;
+        VkRect2D scissor{{0, 0}, frameInfo.extent};
+        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+
+        // 카메라/객체 트랜스폼은 프레임별 버퍼에서 읽으므로 움직여도 재기록이 필요 없음
+        vkCmdBindDescriptorSets(
+            commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout,
+            0, 1, &frameInfo.globalDescriptorSet, 0, nullptr);
+
+        return commandBuffer;
+    }
+
+    void SimpleRenderSystem::endSecondaryCommandBuffer(VkCommandBuffer commandBuffer) {
+        if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to record secondary command buffer!");
+        }
+    }
+
+    bool SimpleRenderSystem::isCacheValid(const RecordingCache &cache, const FrameInfo &frameInfo,
+                                          const LotPipeline &pipeline) const {
+        return cache.valid &&
+               cache.pipeline == &pipeline &&
+               cache.sceneVersion == frameInfo.sceneVersion &&
+               cache.descriptorVersion == frameInfo.descriptorVersion &&
+               cache.renderPass == frameInfo.renderPass &&
+               cache.extent.width == frameInfo.extent.width &&
+               cache.extent.height == frameInfo.extent.height;
+    }
+
+    void SimpleRenderSystem::updateCacheKey(RecordingCache &cache, const FrameInfo &frameInfo,
+                                            const LotPipeline &pipeline) {
+        cache.valid = true;
+        cache.pipeline = &pipeline;
+        cache.sceneVersion = frameInfo.sceneVersion;
+        cache.descriptorVersion = frameInfo.descriptorVersion;
+        cache.renderPass = frameInfo.renderPass;
+        cache.extent = frameInfo.extent;
+    }
+
+    void SimpleRenderSystem::executeSecondaries(FrameInfo &frameInfo,
+                                                const std::vector<VkCommandBuffer> &commandBuffers) {
+        if (!commandBuffers.empty()) {
+            vkCmdExecuteCommands(frameInfo.commandBuffer,
+                                 static_cast<uint32_t>(commandBuffers.size()),
+                                 commandBuffers.data());
         }
     }
 
-    void SimpleRenderSystem::createHighlightPipeline(VkRenderPass renderPass) {
+    void SimpleRenderSystem::renderGameObjects(FrameInfo &frameInfo,
+                                               const std::vector<RenderObject> &renderObjects) {
+        LotPipeline &pipeline = pipelineManager.resolve(*lotPipeline);
+        if (!cachedRecording) {
+            recordGameObjects(frameInfo, renderObjects, pipeline, frameInfo.threadCommandPools, false,
+                              secondaryCommandBuffers);
+            executeSecondaries(frameInfo, secondaryCommandBuffers);
+            return;
+        }
+
+        // 이 프레임 슬롯의 펜스를 기다린 뒤이므로 캐시된 버퍼를 다시 기록해도 안전
+        RecordingCache &cache = objectCaches[frameInfo.frameIndex];
+        if (!isCacheValid(cache, frameInfo, pipeline)) {
+            objectCachePools->resetFrame(frameInfo.frameIndex);
+            recordGameObjects(frameInfo, renderObjects, pipeline, *objectCachePools, true, cache.commandBuffers);
+            updateCacheKey(cache, frameInfo, pipeline);
+        }
+        executeSecondaries(frameInfo, cache.commandBuffers);
+    }
+
+    void SimpleRenderSystem::recordGameObjects(FrameInfo &frameInfo,
+                                               const std::vector<RenderObject> &renderObjects,
+                                               LotPipeline &pipeline, LotThreadCommandPools &pools, bool reusable,
+                                               std::vector<VkCommandBuffer> &commandBuffers) {
+        LOT_PROFILE_SCOPE("SimpleRenderSystem::recordGameObjects");
+        // 드로우 목록을 RECORD_GRAIN_SIZE 단위 구간으로 나눠 구간마다 보조 커맨드 버퍼 하나에 병렬 기록
+        const size_t drawCount = renderObjects.size();
+        const size_t chunkCount = (drawCount + RECORD_GRAIN_SIZE - 1) / RECORD_GRAIN_SIZE;
+        commandBuffers.resize(chunkCount);
+
+        LotJobSystem::instance().parallelFor(chunkCount, 1, [&](size_t chunkBegin, size_t chunkEnd) {
+            for (size_t chunk = chunkBegin; chunk < chunkEnd; chunk++) {
+                LOT_PROFILE_SCOPE("recordGameObjects chunk");
+                VkCommandBuffer commandBuffer = beginSecondaryCommandBuffer(frameInfo, pools, reusable);
+                pipeline.bind(commandBuffer);
+
+                size_t begin = chunk * RECORD_GRAIN_SIZE;
+                size_t end = std::min(begin + RECORD_GRAIN_SIZE, drawCount);
+                for (size_t i = begin; i < end; i++) {
+                    const auto& obj = renderObjects[i];
+
+                    // 객체 버퍼는 renderObjects와 같은 순서로 채워짐
+                    SimplePushConstantData push{};
+                    push.objectIndex = static_cast<uint32_t>(i);
+
+                    vkCmdPushConstants(
+                        commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT,
+                        0, sizeof(SimplePushConstantData), &push);
+
+                    obj.model->bind(commandBuffer);
+                    obj.model->draw(commandBuffer);
+                }
+
+                endSecondaryCommandBuffer(commandBuffer);
+                // 구간 순서대로 실행하므로 드로우 순서는 직렬 기록과 동일
+                commandBuffers[chunk] = commandBuffer;
+            }
+        });
+    }
+
+    void SimpleRenderSystem::requestHighlightPipeline(VkRenderPass renderPass) {
         assert(pipelineLayout != nullptr && "Cannot create highlight pipeline before pipeline layout");
 
         PipelineConfigInfo pipelineConfig{};
@@ -105,39 +272,71 @@ namespace lot {
         pipelineConfig.rasterizationInfo.lineWidth = 3.0f;
         #endif
 
-        highlightPipeline = std::make_unique<LotPipeline>(
-            lotDevice,
+        // simple_shader.frag의 OUTLINE_PASS (constant_id = 0): 외곽선을 단색 하이라이트로 출력
+        pipelineConfig.setSpecializationConstant<VkBool32>(0, VK_TRUE);
+
+        highlightPipeline = &pipelineManager.request(
             "shaders/simple_shader.vert.spv",
             "shaders/simple_shader.frag.spv",
             pipelineConfig);
     }
 
-    void SimpleRenderSystem::renderHighlights(VkCommandBuffer commandBuffer,
-                                            std::vector<LotGameObject> &gameObjects,
-                                            const LotCamera& camera) {
-        highlightPipeline->bind(commandBuffer);
+    void SimpleRenderSystem::renderHighlights(FrameInfo &frameInfo,
+                                              const std::vector<RenderObject> &renderObjects) {
+        // 변형이 컴파일되기 전에는 폴백(기본 파이프라인)으로 그리고, 준비되면 캐시가 다시 기록됨
+        LotPipeline &pipeline = pipelineManager.resolve(*highlightPipeline);
+        if (!cachedRecording) {
+            recordHighlights(frameInfo, renderObjects, pipeline, frameInfo.threadCommandPools, false,
+                             highlightCommandBuffers);
+            executeSecondaries(frameInfo, highlightCommandBuffers);
+            return;
+        }
+
+        RecordingCache &cache = highlightCaches[frameInfo.frameIndex];
+        if (!isCacheValid(cache, frameInfo, pipeline)) {
+            highlightCachePools->resetFrame(frameInfo.frameIndex);
+            recordHighlights(frameInfo, renderObjects, pipeline, *highlightCachePools, true, cache.commandBuffers);
+            updateCacheKey(cache, frameInfo, pipeline);
+        }
+        executeSecondaries(frameInfo, cache.commandBuffers);
+    }
+
+    void SimpleRenderSystem::recordHighlights(FrameInfo &frameInfo,
+                                              const std::vector<RenderObject> &renderObjects,
+                                              LotPipeline &pipeline, LotThreadCommandPools &pools, bool reusable,
+                                              std::vector<VkCommandBuffer> &commandBuffers) {
+        LOT_PROFILE_SCOPE("SimpleRenderSystem::recordHighlights");
+        commandBuffers.clear();
 
-        auto projectionView = camera.getProjection() * camera.getView();
+        // 선택된 객체의 드로우 목록 (프레임 아레나에 두므로 힙 할당 없음)
+        std::pmr::vector<uint32_t> drawList{&frameInfo.frameArena};
+        for (size_t i = 0; i < renderObjects.size(); i++) {
+            if (renderObjects[i].isSelected) {
+                drawList.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        if (drawList.empty()) return;
 
-        int selectedCount = 0;
-        for (auto& obj : gameObjects) {
-            if (!obj.isSelected) continue;
+        // 선택된 객체는 소수이므로 렌더 스레드에서 보조 커맨드 버퍼 하나에 기록
+        VkCommandBuffer commandBuffer = beginSecondaryCommandBuffer(frameInfo, pools, reusable);
+        pipeline.bind(commandBuffer);
 
-            selectedCount++;
+        for (uint32_t i : drawList) {
+            const auto& obj = renderObjects[i];
 
+            // 선택된 객체는 객체 버퍼의 isSelected로 하이라이트 색이 적용됨
             SimplePushConstantData push{};
-            push.color = glm::vec3(1.0f, 0.5f, 0.0f);  // 주황색 하이라이트
-            push.transform = projectionView * obj.transform.mat4();
-            push.isSelected = 1;  // 하이라이트에서는 항상 선택됨
+            push.objectIndex = i;
 
             vkCmdPushConstants(
-                commandBuffer, pipelineLayout,
-                VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT,
                 0, sizeof(SimplePushConstantData), &push);
 
             obj.model->bind(commandBuffer);
             obj.model->draw(commandBuffer);
         }
 
+        endSecondaryCommandBuffer(commandBuffer);
+        commandBuffers.push_back(commandBuffer);
     }
 }
\ No newline at end of file
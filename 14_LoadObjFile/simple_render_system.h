@@ -2,35 +2,87 @@
 
 #include "lot_camera.h"
 #include "lot_device.h"
+#include "lot_frame_info.h"
 #include "lot_game_object.h"
 #include "lot_pipeline.h"
+#include "lot_pipeline_manager.h"
+#include "lot_swap_chain.h"
+#include "lot_thread_command_pools.h"
 
 // std
+#include <array>
 #include <memory>
 #include <vector>
 
 namespace lot {
     class SimpleRenderSystem {
         public:
-            SimpleRenderSystem(LotDevice &device, VkRenderPass renderPass);
+            SimpleRenderSystem(LotDevice &device, LotPipelineManager &pipelineManager,
+                               VkRenderPass renderPass, VkDescriptorSetLayout globalSetLayout);
             ~SimpleRenderSystem();
 
             SimpleRenderSystem(const SimpleRenderSystem &) = delete;
             SimpleRenderSystem& operator=(const SimpleRenderSystem &) = delete;
 
-            void renderGameObjects(VkCommandBuffer commandBuffer, std::vector<LotGameObject> &gameObjects,
-                                   const LotCamera& camera);
-            void renderHighlights(VkCommandBuffer commandBuffer, std::vector<LotGameObject> &gameObjects,
-                                 const LotCamera& camera);
+            void renderGameObjects(FrameInfo &frameInfo, const std::vector<RenderObject> &renderObjects);
+            void renderHighlights(FrameInfo &frameInfo, const std::vector<RenderObject> &renderObjects);
+
+            // 장면(FrameInfo::sceneVersion)이 바뀌지 않으면 이전에 기록한 보조 커맨드 버퍼를 그대로 실행
+            void setCachedRecording(bool enabled) { cachedRecording = enabled; }
+            bool isCachedRecording() const { return cachedRecording; }
+
+            // 스왑체인 포맷이 바뀌어 렌더 패스가 새로 만들어졌을 때 호출 (이전 변형은 관리자가 계속 소유)
+            void recreatePipelines(VkRenderPass renderPass);
+
         private:
-            void createPipelineLayout();
+            // 프레임 슬롯별 캐시: 장면 버전/렌더 패스/크기가 같으면 재사용
+            struct RecordingCache {
+                bool valid = false;
+                uint64_t sceneVersion = 0;
+                uint64_t descriptorVersion = 0;
+                VkRenderPass renderPass = VK_NULL_HANDLE;
+                VkExtent2D extent{0, 0};
+                // 폴백으로 기록했다면 변형이 준비된 뒤 다시 기록해야 함
+                const LotPipeline *pipeline = nullptr;
+                std::vector<VkCommandBuffer> commandBuffers;
+            };
+
+            void createPipelineLayout(VkDescriptorSetLayout globalSetLayout);
             void createPipeline(VkRenderPass renderPass);
-            void createHighlightPipeline(VkRenderPass renderPass);
+            void requestHighlightPipeline(VkRenderPass renderPass);
+
+            VkCommandBuffer beginSecondaryCommandBuffer(FrameInfo &frameInfo, LotThreadCommandPools &pools, bool reusable);
+            void endSecondaryCommandBuffer(VkCommandBuffer commandBuffer);
+            void executeSecondaries(FrameInfo &frameInfo, const std::vector<VkCommandBuffer> &commandBuffers);
+
+            void recordGameObjects(FrameInfo &frameInfo, const std::vector<RenderObject> &renderObjects,
+                                   LotPipeline &pipeline, LotThreadCommandPools &pools, bool reusable,
+                                   std::vector<VkCommandBuffer> &commandBuffers);
+            void recordHighlights(FrameInfo &frameInfo, const std::vector<RenderObject> &renderObjects,
+                                  LotPipeline &pipeline, LotThreadCommandPools &pools, bool reusable,
+                                  std::vector<VkCommandBuffer> &commandBuffers);
+
+            bool isCacheValid(const RecordingCache &cache, const FrameInfo &frameInfo,
+                              const LotPipeline &pipeline) const;
+            static void updateCacheKey(RecordingCache &cache, const FrameInfo &frameInfo,
+                                       const LotPipeline &pipeline);
 
             LotDevice& lotDevice;
+            LotPipelineManager& pipelineManager;
 
-            std::unique_ptr<LotPipeline> lotPipeline;
-            std::unique_ptr<LotPipeline> highlightPipeline;
+            // 파이프라인 객체는 관리자가 소유. 기본 파이프라인은 관리자의 폴백으로도 쓰임
+            const LotPipelineManager::Variant *lotPipeline = nullptr;
+            const LotPipelineManager::Variant *highlightPipeline = nullptr;
             VkPipelineLayout pipelineLayout;
+
+            // 캐시를 쓰지 않을 때 이번 프레임에 기록한 보조 커맨드 버퍼 (구간 순서)
+            std::vector<VkCommandBuffer> secondaryCommandBuffers;
+            std::vector<VkCommandBuffer> highlightCommandBuffers;
+
+            bool cachedRecording = true;
+            std::unique_ptr<LotThreadCommandPools> objectCachePools;
+            std::unique_ptr<LotThreadCommandPools> highlightCachePools;
+            std::array<RecordingCache, LotSwapChain::MAX_FRAMES_IN_FLIGHT> objectCaches{};
+            std::array<RecordingCache, LotSwapChain::MAX_FRAMES_IN_FLIGHT> highlightCaches{};
     };
 }
\ No newline at end of file